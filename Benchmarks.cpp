@@ -0,0 +1,878 @@
+/**************************************************************************************************
+ * Datei: Benchmarks.cpp
+ * Autor: Stefan <St0fF / Neoplasia ^ the Obsessed Maniacs> Kaps, 2024-2025
+ *
+ * Messungen ohne GUI: "PieMenuBench [Name ...]" führt die Benchmarks aus und gibt die Ergebnisse
+ * per qDebug aus.  Ohne Namen laufen alle.  Eigenes Programm, damit das zählende operator new
+ * nicht in PieMenuTesting landet.
+ **************************************************************************************************
+ *  Diese Datei ist Teil von PieMenuTesting.
+ *
+ *  PieMenuTesting ist Freie Software: Sie können es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Wahl) jeder neueren
+ *  veröffentlichten Version, weiter verteilen und/oder modifizieren.
+ *
+ *  PieMenuTesting wird in der Hoffnung, dass es nützlich sein wird, aber
+ *  OHNE JEDE GEWÄHRLEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewährleistung der MARKTFÄHIGKEIT oder EIGNUNG FÜR EINEN BESTIMMTEN ZWECK.
+ *  Siehe die GNU General Public License für weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <https://www.gnu.org/licenses/>.
+ *************************************************************************************************/
+#include "BerechnungsModell.h"
+#include "intersector.h"
+#include "piesimd.h"
+#include "piestates.h"
+#include "qpiemenu.h"
+#if defined( PIE_BENCH_SCXML )
+#	include "States.h"
+
+#	include <QScxmlDataModel>
+#endif
+
+#include <QApplication>
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QList>
+#include <QRandomGenerator>
+#include <QtMath>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#if defined( Q_PROCESSOR_X86 )
+#	if defined( _MSC_VER )
+#		include <intrin.h>
+#	else
+#		include <x86intrin.h>
+#	endif
+#endif
+
+// Allokationszähler für die Benchmarks: ersetzt das globale operator new des Programms, zählt nur
+// mit und reicht an malloc() weiter.
+static std::atomic< quint64 > g_allokationen{ 0 };
+void						 *operator new( std::size_t n )
+{
+	g_allokationen.fetch_add( 1, std::memory_order_relaxed );
+	if ( auto p = std::malloc( n ? n : 1 ) ) return p;
+	throw std::bad_alloc();
+}
+void operator delete( void *p ) noexcept
+{
+	std::free( p );
+}
+void operator delete( void *p, std::size_t ) noexcept
+{
+	std::free( p );
+}
+
+namespace Benchmarks
+{
+	static quint64 cycles()
+	{
+#if defined( Q_PROCESSOR_X86 )
+		return __rdtsc();
+#else
+		return 0;
+#endif
+	}
+
+	// Zeitnahme für eine Schleife: Laufzeit in ns und - auf x86 - Taktzyklen
+	struct Messung
+	{
+		QElapsedTimer et;
+		quint64		  st{ cycles() };
+		Messung() { et.start(); }
+		qint64		  ns() const { return qMax( 1ll, et.nsecsElapsed() ); }
+		quint64		  cyc() const { return cycles() - st; }
+	};
+
+	// QRectF liegt intern als x, y, w, h in qreals vor
+	static const qreal *qs( const QRectF &r )
+	{
+		return reinterpret_cast< const qreal * >( &r );
+	}
+	static qreal *qs( QRectF &r )
+	{
+		return reinterpret_cast< qreal * >( &r );
+	}
+
+	static int pxAbw( const QRect &a, const QRect &b )
+	{
+		return qMax( qMax( qAbs( a.left() - b.left() ), qAbs( a.top() - b.top() ) ),
+					 qMax( qAbs( a.right() - b.right() ), qAbs( a.bottom() - b.bottom() ) ) );
+	}
+	static const char *toleranz( bool ok )
+	{
+		return ok ? "" : "  -> AUSSERHALB DER TOLERANZ";
+	}
+
+	constexpr PieSimd::Level alleStufen[] = { PieSimd::Level::Scalar, PieSimd::Level::SSE2,
+											  PieSimd::Level::AVX2, PieSimd::Level::AVX512 };
+
+#pragma region( SIMD_Kernels )
+	// Zufällige, aber reproduzierbare Animationsdaten - Größenordnungen wie im echten Menü.  Vorne
+	// stehen Randfälle für qRound: Mitte oder Größe genau auf x.5, auch negativ.  Ziel = Quelle und
+	// ein bei t = 0.5 schon abgelaufenes Zeitfenster halten die Werte exakt.
+	static void fuelleLanes( SPLanes &l, int n )
+	{
+		// Radius, Skalierung, Breite/Höhe - der Winkel ist 0, die Mitte liegt also bei ( 0, r )
+		constexpr qreal	 halbe[][ 3 ] = { { 10.5, 1.5, 21. },
+										  { -10.5, 1.5, 21. },
+										  { -0.5, 0.5, 3. },
+										  { -2.5, 2.5, 5. } };
+		QRandomGenerator rg( 0x5eed );
+		l.resize( n );
+		for ( int i = 0; i < l.stride; ++i )
+		{
+			if ( i < qMin( n, int( std::size( halbe ) ) ) )
+			{
+				const qreal q[ 4 ] = { halbe[ i ][ 0 ], 0., 1., halbe[ i ][ 1 ] };
+				l[ SPLanes::W ][ i ] = l[ SPLanes::H ][ i ] = halbe[ i ][ 2 ];
+				l[ SPLanes::T0 ][ i ] = 0., l[ SPLanes::T1 ][ i ] = 0.25;
+				for ( int k = 0; k < 4; ++k )
+					l[ SPLanes::Lane( SPLanes::QR + k ) ][ i ] =
+						l[ SPLanes::Lane( SPLanes::ZR + k ) ][ i ] = q[ k ];
+				continue;
+			}
+			auto t0			   = rg.bounded( 0.5 );
+			l[ SPLanes::W ][ i ]  = 20 + rg.bounded( 200 );
+			l[ SPLanes::H ][ i ]  = 10 + rg.bounded( 40 );
+			l[ SPLanes::T0 ][ i ] = t0;
+			l[ SPLanes::T1 ][ i ] = t0 + 0.1 + rg.bounded( 0.5 );
+			for ( int k = 0; k < 4; ++k )
+			{
+				constexpr qreal skala[] = { 400., 4. * M_PI, 1., 1.5 };
+				l[ SPLanes::Lane( SPLanes::QR + k ) ][ i ] = rg.bounded( skala[ k ] );
+				l[ SPLanes::Lane( SPLanes::ZR + k ) ][ i ] = rg.bounded( skala[ k ] );
+			}
+		}
+	}
+
+	// Dieselben Daten als SPElem für den AoS-Weg des SuperPolator
+	static void alsPolator( const SPLanes &l, SuperPolator &sp )
+	{
+		sp.clear( l.count );
+		for ( int i = 0; i < l.count; ++i )
+		{
+			const QSize sz( int( l[ SPLanes::W ][ i ] ), int( l[ SPLanes::H ][ i ] ) );
+			auto	   &e = sp[ sp.append( sz ) ];
+			e.setT( l[ SPLanes::T0 ][ i ], l[ SPLanes::T1 ][ i ] );
+			for ( int k = 0; k < 4; ++k )
+			{
+				e.quelle()[ k ] = l[ SPLanes::Lane( SPLanes::QR + k ) ][ i ];
+				e.ziel()[ k ]	= l[ SPLanes::Lane( SPLanes::ZR + k ) ][ i ];
+			}
+		}
+	}
+
+	// Jeder Kernel muss den AoS-Weg treffen, also QRect::setSize( toSize() ) und
+	// moveCenter( toPoint() ): Rects pixelgenau, alle anderen Werte bis auf Rechengenauigkeit.
+	static bool simdKernels()
+	{
+		constexpr qreal maxAbw = 1e-9;
+		bool			ok	   = true;
+		const auto	   *ref	   = PieSimd::kernels( PieSimd::Level::Scalar );
+		qDebug() << "SIMD-Kernels, CPU kann" << PieSimd::levelName( PieSimd::supported() )
+				 << "- ausgewählt ist" << PieSimd::kernels().name;
+		for ( int n : { 7, 64, 1024 } )
+		{
+			SPLanes		 lanes;
+			SuperPolator aos;
+			fuelleLanes( lanes, n );
+			alsPolator( lanes, aos );
+			QList< QRect >	 refRects( n ), rects( n );
+			QList< QPointF > refOS( n ), os( n );
+			aos.interpolateAoS( 0.5, refRects, refOS );
+			const int reps = qMax( 1, 4'000'000 / n );
+			for ( auto stufe : alleStufen )
+			{
+				auto k = PieSimd::kernels( stufe );
+				if ( !k )
+				{
+					qDebug() << "\t" << PieSimd::levelName( stufe ) << "n =" << n
+							 << ": nicht verfügbar";
+					continue;
+				}
+				// Genauigkeit
+				SPLanes l( lanes );
+				k->interpolate( l, 0.5, rects.data(), os.data() );
+				int	  px  = 0;
+				qreal abw = 0.;
+				for ( int i = 0; i < n; ++i )
+				{
+					px	= qMax( px, pxAbw( rects[ i ], refRects[ i ] ) );
+					abw = qMax( abw, qMax( qAbs( os[ i ].x() - refOS[ i ].x() ),
+										   qAbs( os[ i ].y() - refOS[ i ].y() ) ) );
+					for ( int c = 0; c < 4; ++c )
+						abw = qMax( abw, qAbs( l[ SPLanes::Lane( SPLanes::CR + c ) ][ i ]
+											   - aos.at( i ).aktuell()[ c ] ) );
+				}
+				const bool gut = px == 0 && abw <= maxAbw;
+				ok &= gut;
+				// Durchsatz
+				Messung m;
+				for ( int r = 0; r < reps; ++r )
+					k->interpolate( l, ( r & 1023 ) / 1023., rects.data(), os.data() );
+				auto ns = m.ns(), cyc = qint64( m.cyc() );
+				qDebug().nospace() << "\t" << k->name << " n = " << n << ": "
+								   << qreal( n ) * reps * 1e3 / ns << " MElem/s, "
+								   << qreal( cyc ) / ( qreal( n ) * reps ) << " Zyklen/Elem, "
+								   << "Abweichung " << px << " px / " << abw << toleranz( gut );
+			}
+		}
+		// Die kleinen Helfer für PieSelectionRect, qLerpRect und qLerpRGBA
+		const QRectF  r0{ 10., 20., 300., 40. }, r1{ -5., 90., 120., 80. };
+		const quint64 c0 = 0xffff'8000'2000'0000ull, c1 = 0x4000'0000'ffff'1234ull;
+		QRectF		  rRef;
+		ref->lerp4( 0.3, qs( r0 ), qs( r1 ), qs( rRef ) );
+		const auto cRef = ref->lerpRgba64( c0, c1, 0.3 );
+		for ( auto stufe : alleStufen )
+		{
+			auto k = PieSimd::kernels( stufe );
+			if ( !k ) continue;
+			constexpr int reps = 10'000'000;
+			QRectF		  r;
+			quint64		  c = 0;
+			Messung		  m;
+			for ( int i = 0; i < reps; ++i )
+				k->lerp4( ( i & 1023 ) / 1023., qs( r0 ), qs( r1 ), qs( r ) );
+			auto	ns4 = m.ns();
+			Messung mc;
+			for ( int i = 0; i < reps; ++i )
+				c ^= k->lerpRgba64( c0, c1 ^ i, ( i & 1023 ) / 1023. );
+			auto nsc = mc.ns();
+			k->lerp4( 0.3, qs( r0 ), qs( r1 ), qs( r ) );
+			const bool gleich = qAbs( r.x() - rRef.x() ) + qAbs( r.y() - rRef.y() )
+									+ qAbs( r.width() - rRef.width() )
+									+ qAbs( r.height() - rRef.height() )
+								<= maxAbw
+							&& k->lerpRgba64( c0, c1, 0.3 ) == cRef;
+			ok &= gleich;
+			qDebug().nospace() << "\t" << k->name << " lerp4: " << reps * 1e3 / ns4
+							   << " M/s, lerpRgba64: " << reps * 1e3 / nsc << " M/s"
+							   << toleranz( gleich ) << " (" << c << ")";
+		}
+		return ok;
+	}
+
+	// Hit-Test über die Rect-Lanes: Index und Abstand müssen bei jeder Stufe exakt dem Scalar-
+	// Ergebnis entsprechen (Ganzzahlen, kein Spielraum).  Ein Menü hat 5..50 Einträge, die großen
+	// n zeigen nur, wohin die Breite der Register führt.
+	static bool hitKernels()
+	{
+		bool		ok	= true;
+		const auto *ref = PieSimd::kernels( PieSimd::Level::Scalar );
+		for ( int n : { 7, 40, 1024 } )
+		{
+			QRandomGenerator rg( 0x417 );
+			PieRectLanes	 h;
+			h.resize( n );
+			for ( int i = 0; i < n; ++i )
+			{
+				h.set( i, { rg.bounded( -300, 300 ), rg.bounded( -300, 300 ), rg.bounded( 20, 220 ),
+							rg.bounded( 10, 50 ) } );
+				h.setSeparator( i, !rg.bounded( 8 ) );
+			}
+			QList< QPoint > pts( 1024 );
+			for ( auto &p : pts ) p = { rg.bounded( -400, 400 ), rg.bounded( -400, 400 ) };
+			const int reps = qMax( 1, 8'000'000 / ( n * int( pts.count() ) ) );
+			for ( auto stufe : alleStufen )
+			{
+				auto k = PieSimd::kernels( stufe );
+				if ( !k ) continue;
+				int falsch = 0, d, dRef;
+				for ( const auto &p : std::as_const( pts ) )
+					for ( auto skip : { PieRectLanes::SkipSep, PieRectLanes::SkipPad } )
+						falsch += k->minBoxDistance( h, skip, p, &d )
+									  != ref->minBoxDistance( h, skip, p, &dRef )
+								  || d != dRef;
+				ok &= !falsch;
+				qint64	sum = 0;
+				Messung m;
+				for ( int r = 0; r < reps; ++r )
+					for ( const auto &p : std::as_const( pts ) )
+						sum += k->minBoxDistance( h, PieRectLanes::SkipSep, p, &d );
+				auto ns = m.ns(), cyc = qint64( m.cyc() );
+				auto anz = qreal( n ) * reps * pts.count();
+				qDebug().nospace() << "\t" << k->name << " n = " << n << ": " << anz * 1e3 / ns
+								   << " MBox/s, " << qreal( cyc ) / anz << " Zyklen/Box, "
+								   << falsch << " Abweichungen" << toleranz( !falsch ) << " ("
+								   << sum << ")";
+			}
+		}
+		return ok;
+	}
+
+	// Überlappungssuche über die QRectF-Lanes: first/lastOverlap müssen bei jeder Stufe exakt den
+	// Scalar-Index liefern.  Danach SimdIntersector gegen Intersector beim Aufbau eines Layouts:
+	// n Boxen, jede wird erst gegen alle vorherigen geprüft.
+	static bool ueberlappKernels()
+	{
+		bool		ok	= true;
+		const auto *ref = PieSimd::kernels( PieSimd::Level::Scalar );
+		for ( int n : { 7, 40, 1024 } )
+		{
+			QRandomGenerator rg( 0x0b5 );
+			auto			 box = [ & ]
+			{
+				return QRectF( rg.bounded( -400, 400 ), rg.bounded( -400, 400 ),
+							   20. + rg.bounded( 200 ), 10. + rg.bounded( 40 ) );
+			};
+			PieRectFLanes lanes;
+			for ( int i = 0; i < n; ++i ) lanes.append( box() );
+			QList< QRectF > kandidaten( 1024 );
+			for ( auto &k : kandidaten ) k = box();
+			const int reps = qMax( 1, 8'000'000 / ( n * int( kandidaten.count() ) ) );
+			for ( auto stufe : alleStufen )
+			{
+				auto k = PieSimd::kernels( stufe );
+				if ( !k ) continue;
+				int falsch = 0;
+				for ( const auto &c : std::as_const( kandidaten ) )
+				{
+					const qreal e[ 4 ] = { c.left(), c.top(), c.right(), c.bottom() };
+					for ( int bis : { n, n / 2 } )
+						falsch +=
+							k->lastOverlap( lanes, e, bis ) != ref->lastOverlap( lanes, e, bis );
+					falsch += k->firstOverlap( lanes, e ) != ref->firstOverlap( lanes, e );
+				}
+				ok &= !falsch;
+				// Durchsatz: die Kandidaten rechts neben alle Boxen geschoben - kein Treffer, also
+				// muss jeder Kernel die ganze Liste ansehen
+				qint64	sum = 0;
+				Messung m;
+				for ( int r = 0; r < reps; ++r )
+					for ( const auto &c : std::as_const( kandidaten ) )
+					{
+						const qreal e[ 4 ] = { c.left() + 1e3, c.top(), c.right() + 1e3,
+											   c.bottom() };
+						sum += k->lastOverlap( lanes, e, n );
+					}
+				auto ns = m.ns(), cyc = qint64( m.cyc() );
+				auto anz = qreal( n ) * reps * kandidaten.count();
+				qDebug().nospace() << "\t" << k->name << " n = " << n << ": " << anz * 1e3 / ns
+								   << " MRect/s, " << qreal( cyc ) / anz << " Zyklen/Rect, "
+								   << falsch << " Abweichungen" << toleranz( !falsch ) << " ("
+								   << sum << ")";
+			}
+		}
+		// Layout-Aufbau mit den ausgewählten Kernels
+		for ( int n : { 8, 16, 64 } )
+		{
+			QRandomGenerator rg( 0x1a7 );
+			QList< QRectF >	 boxen( 100'000 );
+			for ( auto &b : boxen )
+				b = { qreal( rg.bounded( -300, 300 ) ), qreal( rg.bounded( -300, 300 ) ),
+					  20. + rg.bounded( 40 ), 10. + rg.bounded( 20 ) };
+			auto lauf = [ & ]( auto &is, int &frei )
+			{
+				Messung m;
+				is.add( boxen.first() );
+				for ( const auto &b : std::as_const( boxen ) )
+				{
+					if ( is.count() >= n ) is.resetToFirst();
+					frei += is.add( b );
+				}
+				return m.ns();
+			};
+			Intersector< QRectF, QPointF > einfach;
+			SimdIntersector				   simd;
+			int							   freiE = 0, freiS = 0;
+			const auto					   nsE = lauf( einfach, freiE ), nsS = lauf( simd, freiS );
+			ok &= freiE == freiS;
+			qDebug().nospace() << "\tIntersector n = " << n << ": " << nsE / 1e6
+							   << " ms, SimdIntersector (" << PieSimd::kernels().name
+							   << "): " << nsS / 1e6 << " ms (x" << qreal( nsE ) / nsS << ")"
+							   << toleranz( freiE == freiS );
+		}
+		return ok;
+	}
+#pragma endregion
+
+#pragma region( Zustaende )
+	// Eine aufgezeichnete Eingabe: Event samt der Messwerte, die QPieMenu::zeigerAuswerten() der
+	// Zustandstabelle mitgibt.
+	struct Aufnahme
+	{
+		PieStateTable::Event art;
+		qreal				 dM{ 0. }, dI{ 0. };
+		int					 id{ -1 };
+	};
+	// Menü-Zustand wie in QPieMenu: was die init*()-Methoden an Status und IDs hinterlassen
+	struct MenuModell
+	{
+		enum Status { hidden, still, closeby, hover } s{ hidden };
+		int	 folgeId{ -1 }, hoverId{ -1 };
+		void initStill() { folgeId = hoverId = -1, s = still; }
+		void initCloseBy( int id )
+		{
+			folgeId = id;
+			if ( id != -1 ) s = closeby;
+		}
+		void initHover( int id = -1 )
+		{
+			if ( id == hoverId ) return;
+			if ( id == -1 ) hoverId = -1;
+			else folgeId = hoverId = id, s = hover;
+		}
+		void initHidden() { folgeId = hoverId = -1, s = hidden; }
+		bool operator==( const MenuModell &o ) const
+		{
+			return s == o.s && folgeId == o.folgeId && hoverId == o.hoverId;
+		}
+	};
+
+	// Die Referenz: der switch, der bis zur Zustandstabelle in QPieMenu::zeigerAuswerten() stand,
+	// dazu Ein-/Ausblenden und die Tastatur so, wie QPieMenu sie behandelt.
+	struct InlineSwitch : MenuModell
+	{
+		bool  kbdOvr{ false };
+		qreal minDm{ 0. }, r2{ 0. };
+		void  start( qreal dm, qreal r0 )
+		{
+			static_cast< MenuModell & >( *this ) = {};
+			kbdOvr = false, minDm = dm, r2 = 2 * r0;
+		}
+		void ereignis( const Aufnahme &a )
+		{
+			switch ( a.art )
+			{
+				case PieStateTable::showEvent:
+					if ( s == hidden ) initStill();
+					break;
+				case PieStateTable::hideEvent: initHidden(); break;
+				case PieStateTable::keyPress:
+					kbdOvr = true;
+					if ( s == hover ) initHover(), initStill();
+					else if ( s == closeby ) initStill();
+					break;
+				case PieStateTable::keyOvrTimeout: kbdOvr = false; break;
+				case PieStateTable::mouseMove:
+				{
+					if ( kbdOvr ) break;
+					auto hit	 = a.id >= 0 && a.dI <= 0;
+					auto closeBy = !hit && a.dM >= minDm && a.dI <= r2 && a.id != -1;
+					switch ( s )
+					{
+						case still:
+							if ( hit ) initHover( a.id );
+							else if ( closeBy ) initCloseBy( a.id );
+							break;
+						case closeby:
+							if ( hit ) initHover( a.id );
+							else if ( !closeBy ) initStill();
+							else if ( folgeId != a.id ) initCloseBy( a.id );
+							break;
+						case hover:
+							if ( !hit )
+							{
+								initHover();
+								if ( closeBy ) initCloseBy( a.id );
+								else initStill();
+							} else if ( a.id != hoverId ) initHover( a.id );
+							break;
+						default: break;
+					}
+					break;
+				}
+				default: break;
+			}
+		}
+	};
+
+	// Die erzeugte Tabelle - Übergänge werden wie in QPieMenu::zustandsEvent() abgebildet
+	struct Tabelle : MenuModell
+	{
+		PieStateTable::Data			   sm;
+		PieStates::Maschine< Tabelle > m{ sm, *this };
+		void uebergang( PieStateTable::State von, PieStateTable::State nach,
+						const PieStateTable::Data &d )
+		{
+			if ( von == PieStateTable::selected && nach != PieStateTable::selected ) initHover();
+			switch ( nach )
+			{
+				case PieStateTable::hidden: initHidden(); break;
+				case PieStateTable::still: initStill(); break;
+				case PieStateTable::closeBy: initCloseBy( int( d.id ) ); break;
+				case PieStateTable::selected: initHover( int( d.id ) ); break;
+				default: break;
+			}
+		}
+		void senden( PieStateTable::Event, int ) {}
+		void abbrechen( PieStateTable::Event ) {}
+		void start( qreal minDm, qreal r0 )
+		{
+			static_cast< MenuModell & >( *this ) = {};
+			sm									   = {};
+			m.starten();
+			PieStateTable::Data e;
+			e.minDm = minDm, e.r0 = r0;
+			m.ereignis( PieStateTable::initEvent, e );
+		}
+		void ereignis( const Aufnahme &a )
+		{
+			PieStateTable::Data e;
+			e.dM = a.dM, e.dI = a.dI, e.id = a.id;
+			m.ereignis( a.art, e );
+		}
+	};
+
+#if defined( PIE_BENCH_SCXML )
+	// Der Weg vor der Tabelle: PieMenuState, per qt_add_statecharts aus demselben States.scxml
+	// erzeugt.  Events laufen über submitEvent() und die Eventschleife; zugestellt werden nur die
+	// eingereihten Aufrufe, keine Timer - keyOvrTimeout kommt wie bei den anderen Wegen aus der
+	// Aufnahme.  Status und IDs liest der Weg aus Konfiguration und Datenmodell.
+	struct Scxml : MenuModell
+	{
+		std::unique_ptr< PieMenuState > sm;
+		QString							namen[ PieStateTable::EventCount ],
+			zustand[ PieStateTable::StateCount ];
+		Scxml()
+		{
+			for ( int e = 0; e < PieStateTable::EventCount; ++e )
+				namen[ e ] = QString::fromLatin1( PieStateTable::eventNames[ e ] );
+			for ( int z = 0; z < PieStateTable::StateCount; ++z )
+				zustand[ z ] = QString::fromLatin1( PieStateTable::stateNames[ z ] );
+		}
+		static void verarbeiten()
+		{
+			QCoreApplication::sendPostedEvents( nullptr, QEvent::MetaCall );
+		}
+		int wert( const char *n ) const
+		{
+			return sm->dataModel()->scxmlProperty( QString::fromLatin1( n ) ).toInt();
+		}
+		void start( qreal minDm, qreal r0 )
+		{
+			static_cast< MenuModell & >( *this ) = {};
+			sm									   = std::make_unique< PieMenuState >();
+			sm->start();
+			sm->submitEvent( namen[ PieStateTable::initEvent ],
+							 QVariantMap{ { "minDm", minDm }, { "r0", r0 } } );
+			verarbeiten();
+		}
+		void ereignis( const Aufnahme &a )
+		{
+			if ( a.art == PieStateTable::mouseMove )
+				sm->submitEvent( namen[ a.art ],
+								 QVariantMap{ { "dM", a.dM }, { "dI", a.dI }, { "id", a.id } } );
+			else sm->submitEvent( namen[ a.art ] );
+			verarbeiten();
+			auto aktiv = [ & ]( PieStateTable::State z ) { return sm->isActive( zustand[ z ] ); };
+			if ( aktiv( PieStateTable::selected ) ) s = hover, folgeId = hoverId = wert( "selId" );
+			else if ( aktiv( PieStateTable::closeBy ) )
+				s = closeby, folgeId = wert( "folgeId" ), hoverId = -1;
+			else if ( aktiv( PieStateTable::still ) ) initStill();
+			else initHidden();
+		}
+	};
+#endif
+
+	// Reproduzierbare Sitzung mit einem Menü aus 12 Elementen: der Zeiger fährt mit etwas Schwung
+	// durchs Menü, ab und zu wird das Menü neu geöffnet oder die Tastatur übernimmt für eine Weile.
+	// Abstände kommen aus demselben Hit-Kernel wie im Menü.
+	static QList< Aufnahme > aufzeichnen( int n, qreal r0 )
+	{
+		constexpr int	 elemente = 12;
+		QRandomGenerator rg( 0xd15 );
+		PieRectLanes	 h;
+		h.resize( elemente );
+		for ( int i = 0; i < elemente; ++i )
+		{
+			auto a = 2 * M_PI * i / elemente;
+			h.set( i, QRect( int( r0 * qSin( a ) ) - 40, int( r0 * qCos( a ) ) - 12, 80, 24 ) );
+			h.setSeparator( i, false );
+		}
+		QList< Aufnahme > r;
+		r.reserve( n );
+		QPointF p, v;
+		int		tastatur = 0;
+		r.append( { PieStateTable::showEvent } );
+		while ( r.count() < n )
+		{
+			if ( !rg.bounded( 2000 ) )
+			{
+				r.append( { PieStateTable::hideEvent } ), r.append( { PieStateTable::showEvent } );
+				p = v = {};
+				continue;
+			}
+			if ( !tastatur && !rg.bounded( 500 ) )
+			{
+				r.append( { PieStateTable::keyPress } );
+				r.append( { PieStateTable::navKeyReleased } );
+				tastatur = 20 + rg.bounded( 40 );
+			} else if ( tastatur && !--tastatur ) r.append( { PieStateTable::keyOvrTimeout } );
+			v = 0.9 * v + QPointF( rg.bounded( 8. ) - 4., rg.bounded( 8. ) - 4. );
+			p += v;
+			if ( qSqrt( QPointF::dotProduct( p, p ) ) > 2 * r0 ) p *= 0.5, v = -v;
+			int		  d;
+			auto	  pt = p.toPoint();
+			const int id = PieSimd::kernels().minBoxDistance( h, PieRectLanes::SkipSep, pt, &d );
+			r.append( { PieStateTable::mouseMove, qSqrt( qreal( QPoint::dotProduct( pt, pt ) ) ),
+						qreal( d ), id } );
+		}
+		return r;
+	}
+
+	// Eine Aufzeichnung durch einen Weg schicken: erst die Abweichungen vom Referenz-Zustand nach
+	// jedem Event zählen, dann Events pro Sekunde und Allokationen pro Event messen.
+	template < class Weg >
+	static bool abspielen( const char *name, const QList< Aufnahme > &aufnahme,
+						   const QList< MenuModell > &referenz, qreal minDm, qreal r0,
+						   int reps = 20 )
+	{
+		Weg z;
+		int falsch = 0;
+		z.start( minDm, r0 );
+		for ( int i = 0; i < aufnahme.count(); ++i )
+		{
+			z.ereignis( aufnahme[ i ] );
+			falsch += !( static_cast< const MenuModell & >( z ) == referenz[ i ] );
+		}
+		int		sum = 0;
+		auto	st	= g_allokationen.load( std::memory_order_relaxed );
+		Messung m;
+		for ( int r = 0; r < reps; ++r )
+		{
+			z.start( minDm, r0 );
+			for ( const auto &a : aufnahme ) z.ereignis( a );
+			sum += z.s + z.folgeId + z.hoverId;
+		}
+		auto ns = m.ns(), cyc = qint64( m.cyc() );
+		auto all = g_allokationen.load( std::memory_order_relaxed ) - st;
+		auto anz = qreal( reps ) * aufnahme.count();
+		qDebug().nospace() << "\t" << name << ": " << anz * 1e3 / ns << " MEvents/s, "
+						   << qreal( cyc ) / anz << " Zyklen/Event, " << all / anz
+						   << " Allokationen/Event, " << falsch << " Abweichungen"
+						   << toleranz( !falsch ) << " (" << sum << ")";
+		return !falsch;
+	}
+
+	// Dieselbe Aufzeichnung durch den alten switch (liefert die Referenz-Spur), durch die aus
+	// States.scxml erzeugte Tabelle und - wenn Qt Scxml da ist - durch die QScxmlStateMachine.
+	// Die ist um Größenordnungen langsamer, daher nur ein Durchlauf.
+	static bool zustaende()
+	{
+		constexpr qreal r0 = 120., minDm = 12.;
+		const auto		aufnahme = aufzeichnen( 200'000, r0 );
+		QList< MenuModell > referenz;
+		referenz.reserve( aufnahme.count() );
+		InlineSwitch sw;
+		sw.start( minDm, r0 );
+		for ( const auto &a : aufnahme ) sw.ereignis( a ), referenz.append( sw );
+		int wechsel = 0;
+		for ( int i = 1; i < referenz.count(); ++i )
+			wechsel += !( referenz[ i ] == referenz[ i - 1 ] );
+		qDebug() << "Zustände:" << aufnahme.count() << "Events," << wechsel << "Zustandswechsel";
+		bool ok = abspielen< InlineSwitch >( "switch", aufnahme, referenz, minDm, r0 );
+		ok &= abspielen< Tabelle >( "Tabelle", aufnahme, referenz, minDm, r0 );
+#if defined( PIE_BENCH_SCXML )
+		ok &= abspielen< Scxml >( "QScxmlStateMachine", aufnahme, referenz, minDm, r0, 1 );
+#endif
+		return ok;
+	}
+#pragma endregion
+
+#pragma region( Strategien )
+	// Alle Platzierungs-Strategien auf denselben, menügroßen Boxen per
+	// BerechnungsModell::evaluateAll().  Die Einstellungen entsprechen den Startwerten der
+	// Oberfläche.
+	static bool strategien()
+	{
+		BerechnungsModell	  mdl;
+		QRandomGenerator	  rg( 0x5eed );
+		StrategieBasis::Items items;
+		for ( int i = 0; i < 12; ++i )
+			items.append( QRectF( 0., 0., 60. + rg.bounded( 120 ), 22. ) );
+		mdl.setStartAngle( 0 ), mdl.setOpenParam( 270 ), mdl.setDirection( true );
+		for ( int row = 0; row < mdl.rowCount(); ++row )
+		{
+			auto idx = mdl.index( row, 0 );
+			mdl.selectOption( idx, mdl.defaultRadiusPolicy( idx ) );
+		}
+		// Vollständig ist eine Strategie, wenn sie alle Boxen platziert hat
+		const auto							 ergebnis = mdl.evaluateAll( items );
+		const BerechnungsModell::Auswertung *beste	  = nullptr;
+		for ( const auto &e : ergebnis )
+			if ( e.items.count() == items.count() && e.kennzahlen.radius > 0.
+				 && ( !beste || e.kennzahlen.radius < beste->kennzahlen.radius ) )
+				beste = &e;
+		if ( beste ) qDebug() << "Kleinster Radius:" << beste->strategie;
+		return beste != nullptr;
+	}
+#pragma endregion
+
+#pragma region( Ueberlappung )
+	// n menügroße Boxen im Raster, leicht verwackelt - überlappungsfrei, damit beide Verfahren
+	// die ganze Liste ansehen müssen.  Mit verschoben wird jede siebte Box halb auf ihren
+	// Nachbarn geschoben.
+	static Intersector< QRectF, QPointF > rasterBoxen( int n, bool verschoben )
+	{
+		QRandomGenerator			   rg( 0x5eed );
+		Intersector< QRectF, QPointF > boxen;
+		const int					   spalten = qCeil( qSqrt( n ) );
+		for ( int i = 0; i < n; ++i )
+		{
+			QRectF r( ( i % spalten ) * 200. + rg.bounded( 20 ),
+					  ( i / spalten ) * 30. + rg.bounded( 6 ), 60. + rg.bounded( 120 ), 22. );
+			if ( verschoben && i % 7 == 6 ) r.translate( -100., 0. );
+			boxen.append( r );
+		}
+		return boxen;
+	}
+
+	// checkIntersections() (alle Paare) gegen sweepIntersections().  Die Paarliste des Sweeps muss
+	// genau die Paare der verschachtelten Schleife enthalten.
+	static bool ueberlappung()
+	{
+		bool ok = true;
+		for ( int n : { 10, 100, 1'000, 10'000 } )
+		{
+			auto boxen = rasterBoxen( n, false );
+			// Laufzeit: ohne Überlappung bricht keins der beiden Verfahren vorzeitig ab
+			const int repsN = qMax( 1, 50'000'000 / ( n * n ) ), repsS = qMax( 1, 5'000'000 / n );
+			bool	  hatN = false, hatS = false;
+			Messung	  mn;
+			for ( int r = 0; r < repsN; ++r ) hatN |= boxen.checkIntersections();
+			const auto nsN = mn.ns() / repsN;
+			Messung	   ms;
+			for ( int r = 0; r < repsS; ++r ) hatS |= boxen.sweepIntersections();
+			const auto nsS = ms.ns() / repsS;
+			// Vollständigkeit: alle Paare gegen die verschachtelte Schleife
+			auto						   schief = rasterBoxen( n, true );
+			QList< std::pair< int, int > > paare;
+			schief.sweepIntersections( &paare );
+			std::sort( paare.begin(), paare.end() );
+			QList< std::pair< int, int > > erwartet;
+			for ( int i = 0; i < n; ++i )
+				for ( int j = 0; j < i; ++j )
+					if ( schief.at( i ).intersects( schief.at( j ) ) ) erwartet.append( { i, j } );
+			const bool gut = !hatN && !hatS && paare == erwartet;
+			ok &= gut;
+			qDebug().nospace() << "\tn = " << n << ": verschachtelt " << nsN / 1e3 << " µs, Sweep "
+							   << nsS / 1e3 << " µs (x" << qreal( nsN ) / nsS << "), "
+							   << paare.count() << "/" << erwartet.count() << " Paare"
+							   << toleranz( gut );
+		}
+		return ok;
+	}
+
+	// Ein abgeleiteter Intersector I gegen den Intersector: dieselbe zufällige Folge von add(),
+	// addAnyhow(), changeItem() und resetToFirst() auf beiden.  Nach jedem Schritt müssen
+	// Rückgabewert, Länge, _hasIntersection und _lastIntersection übereinstimmen, am Ende die ganze
+	// Liste.  Der IndexedIntersector benutzt sein Gitter erst ab LINEAR_MAX Rects - n muss also
+	// deutlich darüber liegen.  Der SimdIntersector rechnet mit den Kernels von PieSimd::kernels().
+	template < class I >
+	static bool intersectorVergleich( const char *typ, int n, int schritte )
+	{
+		using R = typename I::R_type;
+		struct Stand
+		{
+			bool	  rueck, hat;
+			R		  letzte;
+			qsizetype anzahl;
+			bool	  operator==( const Stand & ) const = default;
+		};
+		// Bei n Boxen ist das Feld etwa zu einem Drittel belegt - add() scheitert oft genug
+		const int feld = 25 * qCeil( qSqrt( n ) );
+		auto	  lauf = [ & ]( auto &is, QList< Stand > &staende )
+		{
+			// Der Zufall hängt nur vom Saatwert und den Längen ab - solange beide gleich
+			// antworten, bekommen sie auch dieselben Schritte
+			QRandomGenerator rg( 0x1d3 );
+			auto			 box = [ & ]
+			{
+				auto x = rg.bounded( -feld, feld ), y = rg.bounded( -feld, feld );
+				return R( x, y, 10 + rg.bounded( 50 ), 5 + rg.bounded( 25 ) );
+			};
+			staende.reserve( schritte );
+			Messung m;
+			is.add( box() );
+			for ( int s = 0; s < schritte; ++s )
+			{
+				bool rueck = true;
+				auto i	   = rg.bounded( int( is.count() ) );
+				auto b	   = box();
+				if ( is.count() >= n ) is.resetToFirst();
+				else
+					switch ( rg.bounded( 10 ) )
+					{
+						case 0: is.addAnyhow( b ); break;
+						case 1: rueck = is.changeItem( i, b ); break;
+						case 2: rueck = is.changeItem( i, b.center() ); break;
+						// Sonst bliebe _hasIntersection nach dem ersten Treffer für immer stehen
+						case 3: is.resetIntersection(); break;
+						default: rueck = is.add( b ); break;
+					}
+				staende.append( { rueck, is._hasIntersection, is._lastIntersection, is.count() } );
+			}
+			return m.ns();
+		};
+		Intersector< R, typename I::P_type > einfach;
+		I									 anderer;
+		QList< Stand >						 stE, stA;
+		const auto							 nsE = lauf( einfach, stE ), nsA = lauf( anderer, stA );
+		int									 falsch = 0;
+		for ( int s = 0; s < schritte; ++s ) falsch += !( stE.at( s ) == stA.at( s ) );
+		const bool gut = !falsch && static_cast< const QList< R > & >( einfach ) == anderer;
+		qDebug().nospace() << "\t" << typ << " n = " << n << ": " << nsA / 1e6
+						   << " ms, Intersector " << nsE / 1e6 << " ms (x" << qreal( nsE ) / nsA
+						   << "), " << falsch << " Abweichungen" << toleranz( gut );
+		return gut;
+	}
+	static bool intersectorVergleiche()
+	{
+		using IF = IndexedIntersector< QRectF, QPointF >;
+		using II = IndexedIntersector< QRect, QPoint >;
+		bool ok	 = true;
+		for ( int n : { 32, 256, 2'000 } )
+		{
+			ok &= intersectorVergleich< IF >( "IndexedIntersector< QRectF >", n, 100'000 );
+			ok &= intersectorVergleich< II >( "IndexedIntersector< QRect >", n, 100'000 );
+			ok &= intersectorVergleich< SimdIntersector >( "SimdIntersector", n, 100'000 );
+		}
+		return ok;
+	}
+#pragma endregion
+
+	struct Eintrag
+	{
+		const char *name;
+		bool ( *fn )();
+	};
+	static const Eintrag alle[] = {
+		{ "simd", simdKernels },
+		{ "hit", hitKernels },
+		{ "overlap", ueberlappKernels },
+		{ "states", zustaende },
+		{ "strategien", strategien },
+		{ "intersect", ueberlappung },
+		{ "intersectors", intersectorVergleiche },
+	};
+
+	// Gibt die Zahl der Benchmarks zurück, die außerhalb ihrer Toleranzen lagen
+	static int run( const QStringList &args )
+	{
+		// alle Argumente sind Namen - leer heißt: alle
+		auto namen = args.mid( 1 );
+		int	 fehler = 0;
+		for ( const auto &b : alle )
+		{
+			if ( !namen.isEmpty() && !namen.contains( b.name ) ) continue;
+			qDebug() << "=== Benchmark" << b.name << "===";
+			if ( !b.fn() ) ++fehler, qDebug() << "!!! Benchmark" << b.name << "fehlgeschlagen";
+		}
+		return fehler;
+	}
+} // namespace Benchmarks
+
+int main( int argc, char *argv[] )
+{
+	// BerechnungsModell fragt den Style - also eine QApplication, auch ohne Fenster
+	QApplication a( argc, argv );
+	return Benchmarks::run( a.arguments() );
+}
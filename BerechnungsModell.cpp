@@ -22,6 +22,11 @@
  *************************************************************************************************/
 #include "BerechnungsModell.h"
 
+#include <QApplication>
+#include <QElapsedTimer>
+#include <QStyle>
+#include <QThreadPool>
+
 BerechnungsModell::BerechnungsModell( QObject *parent )
 	: QAbstractItemModel( parent )
 {
@@ -100,6 +105,44 @@ void BerechnungsModell::calculateItems( int row, StrategieBasis::Items &items_wi
 		_strategien.at( row )->calculateItems( items_with_sizes );
 }
 
+QList< BerechnungsModell::Auswertung > BerechnungsModell::evaluateAll(
+	const StrategieBasis::Items &items_with_sizes )
+{
+	// Den Style gibt es nur im GUI-Thread - also den Abstand vorher lesen und mitgeben
+	const qreal				  ds = qApp->style()->pixelMetric( QStyle::PM_LayoutVerticalSpacing );
+	QList< Auswertung >		  ergebnis( _strategien.count() );
+	QList< StrategieBasis * > frisch;
+	QThreadPool				  pool;
+	for ( int i = 0; i < _strategien.count(); ++i )
+	{
+		// Die Instanzen der UI bleiben unangetastet, ihre Zwischendaten gehören zur angezeigten
+		// Berechnung.  Gerechnet wird auf einer frischen Instanz aus der Factory, die nur die
+		// Parameter übernimmt - den StrategieBasis-Teil.
+		auto strat = frisch.emplace_back( StrategieFactory::newT( i ) );
+		auto &e	   = ergebnis[ i ];
+		*strat	   = *_strategien.at( i );
+		strat->setSpacing( ds );
+		e.strategie = strat->description(), e.items = items_with_sizes;
+		// Jede Aufgabe fasst nur ihre Strategie und ihren Eintrag an
+		pool.start(
+			[ strat, &e ]
+			{
+				QElapsedTimer et;
+				et.start();
+				strat->calculateItems( e.items );
+				e.ns		 = et.nsecsElapsed();
+				e.kennzahlen = strat->kennzahlen();
+			} );
+	}
+	pool.waitForDone();
+	qDeleteAll( frisch );
+	for ( const auto &e : ergebnis )
+		qDebug().nospace() << "Strategie \"" << e.strategie << "\": r = " << e.kennzahlen.radius
+						   << ", Abdeckung = " << e.kennzahlen.abdeckung << "°, "
+						   << e.kennzahlen.versuche << " Versuche, " << e.ns / 1e3 << " µs";
+	return ergebnis;
+}
+
 Opacities BerechnungsModell::animateItems( int row, qreal t,
 										   StrategieBasis::Items &items_with_sizes )
 {
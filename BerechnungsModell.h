@@ -44,6 +44,18 @@ class BerechnungsModell : public QAbstractItemModel
 	void				calculateItems( int row, StrategieBasis::Items &items_with_sizes );
 	Opacities			animateItems( int row, qreal t, StrategieBasis::Items &items_with_sizes );
 
+	// Alle Strategien auf je einer eigenen Kopie der Items, parallel im QThreadPool.  Gerechnet
+	// wird auf frischen Instanzen mit den aktuellen Parametern, die der UI bleiben unverändert.
+	// Kehrt erst zurück, wenn alle fertig sind.
+	struct Auswertung
+	{
+		QString					   strategie; // description()
+		StrategieBasis::Kennzahlen kennzahlen;
+		qint64					   ns{ 0 }; // Wandzeit von calculateItems()
+		StrategieBasis::Items	   items;
+	};
+	QList< Auswertung > evaluateAll( const StrategieBasis::Items &items_with_sizes );
+
 	int					defaultRadiusPolicy( const QModelIndex &index ) const;
 	int					defaultStrategyID() const { return _strategien.count() - 1; }
 
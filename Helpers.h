@@ -21,6 +21,9 @@
  *****************************************************************************/
 #pragma once
 
+#include "intersector.h"
+#include "piesimd.h"
+
 #include <QColor>
 #include <QPointF>
 #include <QRectF>
@@ -112,155 +115,58 @@ constexpr inline QPointF qSgn( QPointF val, qreal scale )
 			 static_cast< qreal >( ( 0. < val.y() ) - ( val.y() < 0. ) ) * scale };
 }
 
-__forceinline QPointF qSinCos( qreal radians )
+Q_ALWAYS_INLINE QPointF qSinCos( qreal radians )
 {
 	return QPointF{ qSin( radians ), qCos( radians ) };
 }
 
-__forceinline QColor qLerpRGBA( const QColor &c0, const QColor &c1, qreal t )
-{ // Only works as long as the internal QColor Design does not change
-	auto mask_to   = _mm_set_epi64x( 0x0f0f0f030f0f0f02, 0x0f0f0f010f0f0f00 );
-	auto mask_back = _mm_set_epi64x( 0x0f0f0f0f0f0f0f0f, 0x0f0f0f0f0c080400 );
-	auto _t		   = _mm_set_ps1( qMin( 1.f, qMax( 0.f, t ) ) ); // safeguard
-	auto _c0	   = _mm_cvtepi32_ps( _mm_shuffle_epi8( _mm_set1_epi32( c0.rgba() ), mask_to ) );
-	auto _c1	   = _mm_cvtepi32_ps( _mm_shuffle_epi8( _mm_set1_epi32( c1.rgba() ), mask_to ) );
-	// We've reached the future some time ago?
-	// https://fgiesen.wordpress.com/2012/08/15/linear-interpolation-past-present-and-future/
-	auto resf	   = _mm_fmadd_ps( _c1, _t, _mm_fnmadd_ps( _c0, _t, _c0 ) );
-	auto res_i8	   = _mm_shuffle_epi8( _mm_cvtps_epi32( resf ), mask_back );
-	return QColor::fromRgba( _mm_extract_epi32( res_i8, 0 ) );
+Q_ALWAYS_INLINE QColor qLerpRGBA( const QColor &c0, const QColor &c1, qreal t )
+{ // t wird im Kernel auf [0..1] geklammert (safeguard), gerechnet wird mit 16 Bit je Kanal
+	return QColor::fromRgba64( QRgba64::fromRgba64(
+		PieSimd::kernels().lerpRgba64( c0.rgba64(), c1.rgba64(), t ) ) );
 }
-__forceinline QColor qLerpRGBA( Qt::GlobalColor c0, Qt::GlobalColor c1, qreal t )
+Q_ALWAYS_INLINE QColor qLerpRGBA( Qt::GlobalColor c0, Qt::GlobalColor c1, qreal t )
 {
 	return qLerpRGBA( QColor( c0 ), QColor( c1 ), t );
 }
-__forceinline QPointF qLerp2D( const QPointF &p0, const QPointF &p1, qreal t )
-{
-	auto _t( _mm_set1_pd( t ) );
-	auto _p0( _mm_load_pd( reinterpret_cast< const qreal * >( &p0 ) ) );
-	auto _p1( _mm_load_pd( reinterpret_cast< const qreal * >( &p1 ) ) );
-	auto res( _mm_fmadd_pd( _p1, _t, _mm_fnmadd_pd( _p0, _t, _p0 ) ) );
-	return { res.m128d_f64[ 0 ], res.m128d_f64[ 1 ] };
+Q_ALWAYS_INLINE QPointF qLerp2D( const QPointF &p0, const QPointF &p1, qreal t )
+{ // für 2 Werte lohnt kein Kernel-Aufruf
+	return p1 * t - p0 * t + p0;
 }
-__forceinline QRectF qLerpRect( const QRectF &src, const QRectF &tgt, qreal t )
+Q_ALWAYS_INLINE QRectF qLerpRect( const QRectF &src, const QRectF &tgt, qreal t )
 { // This will only work as long as QRectF stays to be x1,y1,w,h of qreal internally.
-	__m256d a( *reinterpret_cast< const __m256d * >( &src ) );
-	__m256d b( *reinterpret_cast< const __m256d * >( &tgt ) );
-	__m256d _t( _mm256_set1_pd( t ) );
-	auto	r = _mm256_fmadd_pd( b, _t, _mm256_fnmadd_pd( a, _t, a ) );
-	return { r.m256d_f64[ 0 ], r.m256d_f64[ 1 ], r.m256d_f64[ 2 ], r.m256d_f64[ 3 ] };
+	QRectF r;
+	PieSimd::kernels().lerp4( t, reinterpret_cast< const qreal * >( &src ),
+							  reinterpret_cast< const qreal * >( &tgt ),
+							  reinterpret_cast< qreal * >( &r ) );
+	return r;
 }
-__forceinline QSizeF qLerpSize( QSizeF s0, QSizeF s1, qreal t )
+Q_ALWAYS_INLINE QSizeF qLerpSize( QSizeF s0, QSizeF s1, qreal t )
 {
 	return fromPoint( qLerp2D( fromSize( s0 ), fromSize( s1 ), t ) );
 }
 
-__forceinline qreal smoothStep( qreal t, qreal t0 = 0., qreal t1 = 1. )
+Q_ALWAYS_INLINE qreal smoothStep( qreal t, qreal t0 = 0., qreal t1 = 1. )
 {
 	auto a = qMax( 0., qMin( 1., ( t - t0 ) / ( t1 - t0 ) ) );
 	return a * a * ( 3 - 2 * a );
 }
-__forceinline qreal superSmoothStep( qreal t, qreal start_max, qreal end_min, int index, int count )
+Q_ALWAYS_INLINE qreal superSmoothStep( qreal t, qreal start_max, qreal end_min, int index,
+									   int count )
 {
 	return smoothStep( t, index * start_max / ( count - 1 ),
 					   end_min + ( index + 1 ) * ( 1. - end_min ) / count );
 }
-__forceinline qreal superSmoothStep( qreal t, qreal a, int index, int count )
+Q_ALWAYS_INLINE qreal superSmoothStep( qreal t, qreal a, int index, int count )
 {
 	return superSmoothStep( t, a, 1. - a, index, count );
 }
 
-__forceinline qreal length( const QPointF &p )
+Q_ALWAYS_INLINE qreal length( const QPointF &p )
 {
 	return qSqrt( QPointF::dotProduct( p, p ) );
 }
 
-// Der Intersektor ist eine Rect(F)-Liste, die beim Hinzufügen mit den "neuen Funktionen"
-// (add(),addAnyhow()...) auch einen Überlappungsstatus der hinzugefügten Rects speichert.
-template < typename R, typename P >
-	requires( std::is_same_v< R, QRect > && std::is_same_v< P, QPoint > )
-			|| ( std::is_same_v< R, QRectF > && std::is_same_v< P, QPointF > )
-struct Intersector : public QList< R >
-{
-	using R_type = R;
-	using P_type = P;
-
-	R	 _lastIntersection, _br;
-	bool _hasIntersection{ false };
-	// overwrite QList::clear()
-	void clear() { _br = {}, resetIntersection(), QList< R >::clear(); }
-	void resetIntersection() { _lastIntersection = {}, _hasIntersection = false; }
-	bool checkIntersections()
-	{
-		int i( QList< R >::count() - 1 );
-		while ( i > 0 )
-		{
-			auto j( i - 1 );
-			while ( j >= 0 )
-			{
-				if ( QList< R >::at( i ).intersects( QList< R >::at( j ) ) )
-				{
-					_lastIntersection = QList< R >::at( i ).intersected( QList< R >::at( j ) );
-					return ( _hasIntersection = true );
-				}
-				--j;
-			}
-			--i;
-		}
-		_lastIntersection = {};
-		return ( _hasIntersection = false );
-	}
-	// add() returns true, if the item can be added without intersections.
-	// If there is an intersection, lastIntersection will be set to the intersection rectangle and
-	// the item is not added.
-	virtual bool add( R_type r )
-	{
-		for ( auto i : *this )
-			if ( ( _lastIntersection = r.intersected( i ) ).isValid() )
-				return !( _hasIntersection = true );
-		QList< R >::append( r );
-		_br |= r;
-		return true;
-	}
-	virtual void addAnyhow( R_type r )
-	{
-		int i( QList< R >::count() );
-		while ( !_hasIntersection && ( --i >= 0 ) )
-			_hasIntersection =
-				( _lastIntersection = r.intersected( QList< R >::at( i ) ) ).isValid();
-		QList< R >::append( r );
-		_br |= r;
-	}
-	// changeItem() returns true, if the item at index can be changed without intersections.
-	virtual bool changeItem( int index, R_type newValue )
-	{
-		if ( QList< R >::at( index ) != newValue )
-		{
-			// assign and recheck bounds
-			QList< R >::operator[]( index ) = newValue;
-			int i( QList< R >::count() );
-			while ( !_hasIntersection && ( --i >= 0 ) )
-				if ( i != index )
-					_hasIntersection =
-						( _lastIntersection = newValue.intersected( QList< R >::at( i ) ) )
-							.isValid();
-			_br |= newValue;
-		}
-		return !_hasIntersection;
-	}
-	virtual bool changeItem( int index, P_type newCenter )
-	{
-		return changeItem( index, QList< R >::at( index ).translated(
-									  newCenter - QList< R >::at( index ).center() ) );
-	}
-	virtual void resetToFirst()
-	{
-		QList< R >::resize( 1 );
-		_br = QList< R >::first();
-		resetIntersection();
-	}
-};
-
 // Mal ein Versuch, die Winkeldifferenzen-Geschichte aus Strategie 3 zu vereinfachen:
 class BestDelta
 {
@@ -269,13 +175,13 @@ class BestDelta
 	BestDelta( bool negAngles )
 		: dir( negAngles ? -1 : 1 )
 	{}
-	__forceinline void init( qreal direction, qreal reference_angle )
+	Q_ALWAYS_INLINE void init( qreal direction, qreal reference_angle )
 	{
 		bad = -( good = std::numeric_limits< qreal >::max() );
 		dir = direction;
 		w0	= reference_angle;
 	}
-	__forceinline void init( qreal reference_angle )
+	Q_ALWAYS_INLINE void init( qreal reference_angle )
 	{
 		bad = -( good = std::numeric_limits< qreal >::max() );
 		w0	= reference_angle;
@@ -285,21 +191,21 @@ class BestDelta
 	constexpr bool	hasBad() const { return bad > -std::numeric_limits< qreal >::max(); }
 	constexpr qreal best() const { return dir * ( hasGood() ? good : hasBad() ? bad : 0.0 ); }
 	template < double halfCircle >
-	__forceinline void addAngle( qreal a )
+	Q_ALWAYS_INLINE void addAngle( qreal a )
 	{
 		auto d = distance< halfCircle >( w0, a ) * dir;
 		if ( d > 0 ) good = qMin( good, d );
 		else if ( d < 0 ) bad = qMax( bad, d );
 	}
 	template < double halfCircle >
-	__forceinline void addBoth( qreal a, bool halfOffs )
+	Q_ALWAYS_INLINE void addBoth( qreal a, bool halfOffs )
 	{
 		addAngle< halfCircle >( a ), addAngle< halfCircle >( qreal( halfOffs ) * halfCircle - a );
 	}
 	// Instanziierungen für die beiden Winkelmaße:
-	__forceinline void addDeg( qreal a ) { addAngle< 180.0 >( a ); }
-	__forceinline void addRad( qreal a ) { addAngle< M_PI >( a ); }
-	__forceinline void addRad2( qreal a, bool isAsin = false ) { addBoth< M_PI >( a, isAsin ); }
+	Q_ALWAYS_INLINE void addDeg( qreal a ) { addAngle< 180.0 >( a ); }
+	Q_ALWAYS_INLINE void addRad( qreal a ) { addAngle< M_PI >( a ); }
+	Q_ALWAYS_INLINE void addRad2( qreal a, bool isAsin = false ) { addBoth< M_PI >( a, isAsin ); }
 
   private:
 	qreal good{ std::numeric_limits< qreal >::max() }, bad{ -std::numeric_limits< qreal >::max() },
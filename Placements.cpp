@@ -23,6 +23,17 @@
 #include "Placements.h"
 
 #include <QtWidgets>
+#if defined( _MSC_VER )
+#	include <intrin.h>
+#else
+#	include <x86intrin.h>
+#endif
+
+qreal StrategieBasis::spacing() const
+{
+	if ( _spacing < 0. ) return qApp->style()->pixelMetric( QStyle::PM_LayoutVerticalSpacing );
+	return _spacing;
+}
 
 ersterVersuch::ersterVersuch()
 	: StrategieBasis::Registrar< ersterVersuch >()
@@ -30,7 +41,11 @@ ersterVersuch::ersterVersuch()
 	_description = QObject::tr( "erste Idee: \"Aufdrehen\"" );
 }
 
-void	  ersterVersuch::calculateItems( Items& items_with_sizes ) {}
+void	  ersterVersuch::calculateItems( Items& items_with_sizes )
+{
+	// Hier wird nur animiert - es gibt keine Ruhepositionen
+	_kennzahlen = {};
+}
 
 Opacities ersterVersuch::animateItems( Items& items, qreal progress )
 {
@@ -84,52 +99,108 @@ void StrategieNo2::calculateItems( Items& items )
 			startRadius = qMin( items.count() * items[ 0 ].height() / 4., startRadius );
 			break;
 	}
-	bool badRadius;
-	// Und nun durchlaufen wir all unsere Items
-	auto radius{ startRadius };
-	// qDebug() << "animate_1: radius=" << radius;
-	do {
-		badRadius = false;
+	// Ein Durchlauf mit festem Radius: jedes Item rückt um den kleinsten Winkelschritt ab min_plus
+	// weiter, bei dem es seinen Vorgänger nicht mehr überdeckt.  Früher wurde der in 128 Schritten
+	// gesucht, jetzt wird er wie in StrategieNo3plus aus den Tangentenwinkeln bestimmt: die Mitten
+	// liegen auf dem Kreis, eine Überdeckung beginnt oder endet genau dort, wo der Mittenabstand in
+	// x oder y die halbe Summe der Box-Größen erreicht.
+	const auto min_plus{ static_cast< qreal >( -minDelta() ) };
+	const auto max_plus{ static_cast< qreal >( -maxDelta() ) };
+	const auto span = max_plus - min_plus, s = qSgn( span );
+	auto	   winkel{ static_cast< qreal >( startAngle() ) };
+	_kennzahlen = {};
+	auto platzieren = [ & ]( qreal radius )
+	{
+		++_kennzahlen.versuche;
 		data.clear();
-		int	 idx{ 0 };
-		auto winkel{ static_cast< qreal >( startAngle() ) };
-		auto min_plus{ static_cast< qreal >( -minDelta() ) };
-		auto max_plus{ static_cast< qreal >( -maxDelta() ) };
+		winkel	= startAngle();
 		auto br = items.first();
-		while ( idx < items.count() )
+		for ( int idx = 0; idx < items.count(); )
 		{ // setze das Item auf die berechneten bzw. initialen Werte
 			br.moveCenter( radius * qSinCos( qDegreesToRadians( winkel ) ) );
 			data.append( qMakePair( radius, winkel ) );
 			items[ idx++ ] = br;
-			// nun haben wir eine bounding Box.  Schauen wir erstmal, ob die des nächsten Elements
-			// jene überschneiden würde, wenn das nächste Item nur um den Minimalwinkel verschoben
-			// angeordnet werden würde ...
-			if ( idx < items.count() )
+			if ( idx == items.count() ) break;
+			// u: Schritt hinter min_plus in Suchrichtung
+			auto	   nbr	 = items[ idx ];
+			const auto w1	 = winkel + min_plus;
+			auto	   setze = [ & ]( qreal u )
 			{
-				auto nbr		= items[ idx ];
-				auto winkelplus = min_plus;
-				for ( ; abs( winkelplus ) <= abs( max_plus );
-					  winkelplus += ( max_plus - min_plus ) / 128. )
+				nbr.moveCenter( radius * qSinCos( qDegreesToRadians( w1 + s * u ) ) );
+				return !br.intersects( nbr );
+			};
+			qreal u = 0.;
+			if ( !setze( u ) )
+			{
+				// Alle Winkel, an denen sich eine Kante von nbr mit einer von br trifft
+				QVarLengthArray< qreal, 8 > kandidaten;
+				auto						dazu = [ & ]( qreal phi )
 				{
-					nbr.moveCenter( radius * qSinCos( qDegreesToRadians( winkel + winkelplus ) ) );
-					if ( !br.intersects( nbr ) ) break; // found next item's position
-				}
-				if ( br.intersects( nbr ) ) // no final position found? Maybe we need to re-run with
-											// a larger radius.
+					auto d = std::fmod( s * ( phi - w1 ), 360. );
+					if ( d < 0. ) d += 360.;
+					if ( d > 0. && d <= qAbs( span ) ) kandidaten.append( d );
+				};
+				const auto c = br.center(), offset = 0.5 * ( fromSize( br ) + fromSize( nbr ) );
+				for ( auto v : { c + offset, c - offset } )
 				{
-					badRadius = true;
-					if ( radius < 50 ) radius += 5;
-					else if ( radius < 100 ) radius += 8;
-					else radius *= 1.05;
-					break;
-				} else {
-					br = nbr;
-					winkel += winkelplus;
+					if ( qAbs( v.x() ) <= radius )
+					{
+						auto n = qRadiansToDegrees( qAsin( v.x() / radius ) );
+						dazu( n ), dazu( 180. - n );
+					}
+					if ( qAbs( v.y() ) <= radius )
+					{
+						auto n = qRadiansToDegrees( qAcos( v.y() / radius ) );
+						dazu( n ), dazu( -n );
+					}
 				}
+				std::sort( kandidaten.begin(), kandidaten.end() );
+				// Der erste, an dem sich die Boxen trennen - genau auf der Tangente kann die
+				// Rundung noch eine hauchdünne Überdeckung liefern
+				u = -1.;
+				for ( auto d : kandidaten )
+					if ( setze( d ) || setze( d += 1e-7 ) )
+					{
+						u = d;
+						break;
+					}
 			}
-			if ( badRadius ) break;
+			// kein Platz bis max_plus: der Radius ist zu klein
+			if ( u < 0. ) return false;
+			// genau der Winkel, der eben geprüft wurde - "winkel += min_plus + s * u" rundet anders
+			br	   = nbr;
+			winkel = w1 + s * u;
+		}
+		return true;
+	};
+	// Radius: mit den bisherigen Schritten nach oben klammern, dann im letzten Schritt bis auf
+	// einen halben Pixel halbieren.  Größere Schritte sparen kaum Durchläufe, springen aber gern
+	// über einen kleineren passenden Radius hinweg - ob es passt, hängt nicht monoton vom Radius
+	// ab.  Ohne Obergrenze würde bei Min-/Max-Delta ohne jeden Spielraum endlos gesucht.
+	constexpr qreal maxRadius = 1e5;
+	auto			radius{ startRadius };
+	bool			passt = platzieren( radius );
+	if ( !passt )
+	{
+		qreal unten = radius;
+		while ( !passt && radius < maxRadius )
+		{
+			unten = radius;
+			if ( radius < 50 ) radius += 5;
+			else if ( radius < 100 ) radius += 8;
+			else radius *= 1.05;
+			passt = platzieren( radius );
 		}
-	} while ( badRadius );
+		while ( passt && radius - unten > 0.5 )
+		{
+			auto mitte = 0.5 * ( unten + radius );
+			if ( platzieren( mitte ) ) radius = mitte;
+			else unten = mitte;
+		}
+		// der letzte Durchlauf war womöglich einer, der nicht gepasst hat
+		if ( passt ) platzieren( radius );
+	}
+	_kennzahlen.radius = radius, _kennzahlen.abdeckung = qAbs( winkel - startAngle() );
 }
 
 Opacities StrategieNo2::animateItems( Items& items, qreal progress )
@@ -166,15 +237,15 @@ void StrategieNo3::calculateItems( Items& items )
 	// Init-daten brauchen wir ...
 	int		direction = static_cast< int >( _direction );
 	qreal	w0 = _startAngle, ww = 0;
-	qreal	ds	  = qApp->style()->pixelMetric( QStyle::PM_LayoutVerticalSpacing );
+	qreal	ds	  = spacing();
 	QPointF scDDt = { 1., -1. }, sz = fromSize( items.first().size() );
 	// Variablen
 	int		btc( 1 ), ic( items.count() );
 	auto	baseHeight = ( ( items.first().height() + ds ) * items.count() /* - ds*/ );
 	qreal	r( baseHeight / 4 ), w( w0 ), np, off;
 	// auto		   dbg = qDebug() << "StrategieNo3 - Startwerte: w0=" << w0 << "r0=" << r;
-	Intersector< QRectF, QPointF > usedSpace;
-	QList< qreal >				   winkelz, delta_w, bad_deltas;
+	IndexedIntersector< QRectF, QPointF > usedSpace;
+	QList< qreal >						  winkelz, delta_w, bad_deltas;
 	auto						   st = __rdtsc();
 	for ( int i = 0; i < ic; ++i )
 	{
@@ -261,7 +332,8 @@ void StrategieNo3::calculateItems( Items& items )
 	qDebug()
 		/*dbg */
 		<< "Strategie No°3 took" << ( et - st ) << "cycles.";
-	items = usedSpace;
+	_kennzahlen = { r, ww, btc };
+	items		= usedSpace;
 }
 
 Opacities animate3( StrategieBasis::Items& items, qreal t, qreal w0, RadiusAngles& data )
@@ -301,7 +373,7 @@ void StrategieNo3plus::calculateItems( Items& items )
 	// Init-daten brauchen wir ...
 	int	  direction = static_cast< int >( _direction ), ic( items.count() );
 	qreal w0 = _startAngle, ww = 0, r, w( w0 ), n,
-		  ds	  = qApp->style()->pixelMetric( QStyle::PM_LayoutVerticalSpacing );
+		  ds	  = spacing();
 	QPointF csDDt = { -1., 1. }, sz = fromSize( items.first().size() );
 	// Variablen
 	int		btc( 1 );
@@ -312,8 +384,8 @@ void StrategieNo3plus::calculateItems( Items& items )
 		default: r = baseHeight * 0.28; break;
 	}
 	// auto		   dbg = qDebug() << "StrategieNo3 - Startwerte: w0=" << w0 << "r0=" << r;
-	Intersector< QRectF, QPointF > usedSpace;
-	BestDelta					   bd;
+	IndexedIntersector< QRectF, QPointF > usedSpace;
+	BestDelta							  bd;
 	usedSpace.reserve( ic );
 	auto st = __rdtsc();
 	for ( int i = 0; i < ic; ++i )
@@ -375,7 +447,8 @@ void StrategieNo3plus::calculateItems( Items& items )
 		/*dbg */
 		<< "Strategie No°3 PLUS took" << ( et - st ) << "cycles, running" << btc
 		<< "iterations, final radius =" << r;
-	items = usedSpace;
+	_kennzahlen = { r, ww, btc };
+	items		= usedSpace;
 }
 
 Opacities StrategieNo3plus::animateItems( Items& items, qreal progress )
@@ -34,6 +34,8 @@ using RadiusAngles = QList< QPair< qreal, qreal > >;
 struct StrategieBasis : Factory< StrategieBasis >
 {
 	StrategieBasis( Key ) {}
+	// Die Factory liefert rohe Zeiger - gelöscht wird über die Basis
+	virtual ~StrategieBasis() = default;
 	// Austauschformat:
 	using Items													= Intersector< QRectF, QPointF >;
 	// Soll die Berechnung initial nach Änderung von Parametern durchführen
@@ -59,11 +61,26 @@ struct StrategieBasis : Factory< StrategieBasis >
 	virtual int		   defaultOption() const { return -1; }
 	int				   selectedOption() const { return _selectedOption; }
 
+	// Kennzahlen der letzten Berechnung, damit sich die Strategien vergleichen lassen:
+	// Endradius, überdeckter Winkel (Grad) und Anzahl der Anläufe (Radius-Versuche)
+	struct Kennzahlen
+	{
+		qreal radius{ 0. }, abdeckung{ 0. };
+		int	  versuche{ 0 };
+	};
+	const Kennzahlen  &kennzahlen() const { return _kennzahlen; }
+	// Abstand zwischen den Boxen.  Das BerechnungsModell setzt ihn im GUI-Thread, damit
+	// calculateItems() auch in einem Worker-Thread keinen Style anfassen muss (< 0: selbst lesen).
+	void			   setSpacing( qreal ds ) { _spacing = ds; }
+	qreal			   spacing() const;
+
 	QString			   _description;
 	QStringList		   _options;
 	int				   _selectedOption{ -1 };
 	Direction		   _direction{ counterclockwise };
 	qreal			   _startAngle{ 0. }, _minDelta{ -20. }, _maxDelta{ -240. }, _openParam{ 0. };
+	qreal			   _spacing{ -1. };
+	Kennzahlen		   _kennzahlen;
 };
 typedef Factory< StrategieBasis > StrategieFactory;
 
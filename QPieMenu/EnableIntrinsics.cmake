@@ -20,13 +20,16 @@
 # Include the required headers
 include(CheckCXXSourceCompiles)
 
-macro( check_cpu Name IntrinMacro WFlag LFlag )
+# Prüft, ob der Compiler den Befehlssatz kann.  Setzt ${Name}_SUPPORTED und ${Name}_FLAGS,
+# verändert aber nicht mehr die globalen Compile-Optionen - sonst wäre das ganze Binary an die
+# CPU des Build-Rechners gebunden.
+macro( check_cpu Name IntrinMacro WFlags LFlags )
 	if( MSVC )
-		set( _co /arch:${WFlag} )
+		set( ${Name}_FLAGS ${WFlags} )
 	else()
-		set( _co -m${LFlag} )
+		set( ${Name}_FLAGS ${LFlags} )
 	endif()
-	set( CMAKE_REQUIRED_FLAGS ${_co} )
+	list( JOIN ${Name}_FLAGS " " CMAKE_REQUIRED_FLAGS )
 	check_cxx_source_compiles( "#include <immintrin.h>
 	int main() {return 
 		#if defined(${IntrinMacro})
@@ -35,12 +38,21 @@ macro( check_cpu Name IntrinMacro WFlag LFlag )
 			1
 		#endif
 	;}" ${Name}_SUPPORTED )
+	unset( CMAKE_REQUIRED_FLAGS )
+endmacro( check_cpu )
+
+# Hängt die Quellen nur dann an das Target, wenn der Befehlssatz unterstützt wird.  Die Flags
+# dienen nur dem Test - übersetzt wird ohne sie, die Kernels setzen ihren Befehlssatz je Funktion
+# (PIE_SIMD_TARGET).  Sonst landen Inline-Funktionen aus Headern als AVX-Code im Binary.
+# PIE_SIMD_${Name} meldet dem Code, dass es die Dateien gibt.
+macro( enable_intrinsics Target Name )
 	if( ${Name}_SUPPORTED )
-		add_compile_options( ${_co} )
+		target_sources( ${Target} PRIVATE ${ARGN} )
+		target_compile_definitions( ${Target} PRIVATE PIE_SIMD_${Name} )
 	endif()
-	unset( _co )
-endmacro( check_cpu )
+endmacro( enable_intrinsics )
 
-#check_cpu( AVX __AVX__ AVX avx )
-#check_cpu( AVX2 __AVX2__ AVX2 avx2 )
-#check_cpu( AVX-512 __AVX512F__ AVX512 avx512f )
+#check_cpu( AVX __AVX__ /arch:AVX -mavx )
+#check_cpu( AVX2 __AVX2__ /arch:AVX2 "-mavx2;-mfma" )
+#check_cpu( AVX512 __AVX512F__ /arch:AVX512 "-mavx512f;-mfma" )
+#enable_intrinsics( MyTarget AVX2 kernel_avx2.cpp )
@@ -0,0 +1,424 @@
+/******************************************************************************
+ * intersector.h - Rect-Listen mit Überlappungsprüfung
+ * ============================================================
+ * Author: Stefan <St0fF / the0bsessedManiacs> Kaps
+ ******************************************************************************
+ *  Diese Datei ist Teil von PieMenuTesting.
+ *
+ *  PieMenuTesting ist Freie Software: Sie können es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Wahl) jeder neueren
+ *  veröffentlichten Version, weiter verteilen und/oder modifizieren.
+ *
+ *  PieMenuTesting wird in der Hoffnung, dass es nützlich sein wird, aber
+ *  OHNE JEDE GEWÄHRLEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewährleistung der MARKTFÄHIGKEIT oder EIGNUNG FÜR EINEN BESTIMMTEN ZWECK.
+ *  Siehe die GNU General Public License für weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <https://www.gnu.org/licenses/>.
+ ******************************************************************************
+ * Der Intersector lag bisher doppelt vor - in Helpers.h für die Strategien und in qpiemenu.h für
+ * die Ruhedaten.  Jetzt gibt es ihn nur noch hier, dazu den IndexedIntersector:
+ *  -   Intersector: jedes neue Rect wird gegen alle gespeicherten geprüft, ein Layout mit n
+ *      Elementen kostet also O(n²) Schnitt-Tests - und das bei jedem neuen Anlauf mit größerem
+ *      Radius.
+ *  -   IndexedIntersector: ein gleichmäßiges Gitter (Zellgröße etwa eine Box) liefert nur die
+ *      Rects, die überhaupt in Frage kommen.  Der exakte Test bleibt derselbe, ebenso die
+ *      Semantik von add(), addAnyhow() und changeItem() samt _lastIntersection.
+ *  -   SimdIntersector: nur für QRectF, hält die Kanten zusätzlich als PieRectFLanes und sucht
+ *      mit den PieSimd-Kernels - 2, 4 oder 8 Rects je Vergleich.  Das Schnitt-Rect wird erst für
+ *      den Treffer berechnet.  Lohnt bei den üblichen Menügrößen, wo das Gitter noch nicht greift.
+ *****************************************************************************/
+#pragma once
+
+#include "piesimd.h"
+
+#include <QHash>
+#include <QList>
+#include <QRect>
+#include <QRectF>
+#include <QVarLengthArray>
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <utility>
+
+// Der Intersektor ist eine Rect(F)-Liste, die beim Hinzufügen mit den "neuen Funktionen"
+// (add(),addAnyhow()...) auch einen Überlappungsstatus der hinzugefügten Rects speichert.
+template < typename R, typename P >
+	requires( std::is_same_v< R, QRect > && std::is_same_v< P, QPoint > )
+			|| ( std::is_same_v< R, QRectF > && std::is_same_v< P, QPointF > )
+struct Intersector : public QList< R >
+{
+	using R_type = R;
+	using P_type = P;
+
+	R	 _lastIntersection, _br;
+	bool _hasIntersection{ false };
+	// overwrite QList::clear()
+	void clear() { _br = {}, resetIntersection(), QList< R >::clear(); }
+	void resetIntersection() { _lastIntersection = {}, _hasIntersection = false; }
+	bool checkIntersections()
+	{
+		int i( QList< R >::count() - 1 );
+		while ( i > 0 )
+		{
+			auto j( i - 1 );
+			while ( j >= 0 )
+			{
+				if ( QList< R >::at( i ).intersects( QList< R >::at( j ) ) )
+				{
+					_lastIntersection = QList< R >::at( i ).intersected( QList< R >::at( j ) );
+					return ( _hasIntersection = true );
+				}
+				--j;
+			}
+			--i;
+		}
+		_lastIntersection = {};
+		return ( _hasIntersection = false );
+	}
+	// Wie checkIntersections(), aber als Sweep-and-Prune: nach linker Kante sortiert, verglichen
+	// wird nur mit den Rects, die nicht schon links vom aktuellen enden - O(n log n + k) statt
+	// O(n²).  Ohne paare endet die Suche beim ersten Treffer; welches Paar das ist, hängt dann von
+	// der Sortierung ab und nicht von der Listenreihenfolge.  Mit paare kommen alle k
+	// überlappenden Paare (größerer Index zuerst), _lastIntersection gehört zum ersten davon.
+	bool sweepIntersections( QList< std::pair< int, int > > *paare = nullptr )
+	{
+		const auto n = QList< R >::count();
+		// normalisiert, damit links/rechts auch bei negativen Breiten stimmen
+		QList< R > nr;
+		nr.reserve( n );
+		for ( const auto &r : std::as_const( *this ) ) nr.append( r.normalized() );
+		QList< int > ord( n ), aktiv;
+		std::iota( ord.begin(), ord.end(), 0 );
+		std::sort( ord.begin(), ord.end(),
+				   [ & ]( int a, int b ) { return nr.at( a ).left() < nr.at( b ).left(); } );
+		if ( paare ) paare->clear();
+		resetIntersection();
+		for ( auto i : ord )
+		{
+			// Wer links vom aktuellen Rect endet, endet auch links von allen folgenden
+			aktiv.removeIf( [ & ]( int j ) { return nr.at( j ).right() < nr.at( i ).left(); } );
+			for ( auto j : std::as_const( aktiv ) )
+			{
+				// der exakte Test wie in checkIntersections()
+				const auto a = qMax( i, j ), b = qMin( i, j );
+				if ( !QList< R >::at( a ).intersects( QList< R >::at( b ) ) ) continue;
+				if ( !_hasIntersection )
+				{
+					_lastIntersection = QList< R >::at( a ).intersected( QList< R >::at( b ) );
+					_hasIntersection  = true;
+				}
+				if ( !paare ) return true;
+				paare->append( { a, b } );
+			}
+			aktiv.append( i );
+		}
+		return _hasIntersection;
+	}
+	// add() returns true, if the item can be added without intersections.
+	// If there is an intersection, lastIntersection will be set to the intersection rectangle and
+	// the item is not added.
+	virtual bool add( R_type r )
+	{
+		for ( auto i : *this )
+			if ( ( _lastIntersection = r.intersected( i ) ).isValid() )
+				return !( _hasIntersection = true );
+		QList< R >::append( r );
+		_br |= r;
+		return true;
+	}
+	virtual void addAnyhow( R_type r )
+	{
+		int i( QList< R >::count() );
+		while ( !_hasIntersection && ( --i >= 0 ) )
+			_hasIntersection =
+				( _lastIntersection = r.intersected( QList< R >::at( i ) ) ).isValid();
+		QList< R >::append( r );
+		_br |= r;
+	}
+	// changeItem() returns true, if the item at index can be changed without intersections.
+	virtual bool changeItem( int index, R_type newValue )
+	{
+		if ( QList< R >::at( index ) != newValue )
+		{
+			// assign and recheck bounds
+			QList< R >::operator[]( index ) = newValue;
+			int i( QList< R >::count() );
+			while ( !_hasIntersection && ( --i >= 0 ) )
+				if ( i != index )
+					_hasIntersection =
+						( _lastIntersection = newValue.intersected( QList< R >::at( i ) ) )
+							.isValid();
+			_br |= newValue;
+		}
+		return !_hasIntersection;
+	}
+	virtual bool changeItem( int index, P_type newCenter )
+	{
+		return changeItem( index, QList< R >::at( index ).translated(
+									  newCenter - QList< R >::at( index ).center() ) );
+	}
+	virtual void resetToFirst()
+	{
+		QList< R >::resize( 1 );
+		_br = QList< R >::first();
+		resetIntersection();
+	}
+};
+
+// Intersector mit Gitter-Index.  Unterhalb von LINEAR_MAX Rects wird wie bisher linear geprüft -
+// da kostet das Gitter mehr, als es spart.  Danach liegt jedes Rect in allen Zellen, die es
+// berührt; geprüft werden nur die Rects aus den Zellen des Kandidaten.
+// ACHTUNG: Nur über add(), addAnyhow(), changeItem(), resetToFirst() und clear() ändern.  Wer die
+// QList direkt beschreibt, muss danach reindex() aufrufen.
+template < typename R, typename P >
+struct IndexedIntersector : public Intersector< R, P >
+{
+	using Basis	 = Intersector< R, P >;
+	using R_type = typename Basis::R_type;
+	using P_type = typename Basis::P_type;
+	static constexpr int LINEAR_MAX = 16;
+
+	using Basis::changeItem;
+
+	// zelle <= 0: beim Aufbau des Gitters wird die mittlere größere Kante der Rects genommen
+	IndexedIntersector( qreal zelle = 0. )
+		: _zelle( zelle ), _zelleFest( zelle > 0. )
+	{}
+
+	void clear()
+	{
+		Basis::clear();
+		_zellen.clear(), _stempel.clear();
+	}
+	bool add( R_type r ) override
+	{
+		// Das erste überlappende Rect in Listenreihenfolge - wie im Intersector
+		int erster = -1;
+		fuerKandidaten( r, -1,
+						[ & ]( int i )
+						{
+							if ( ( erster < 0 || i < erster ) && r.intersects( Basis::at( i ) ) )
+								erster = i;
+						} );
+		if ( erster >= 0 )
+		{
+			Basis::_lastIntersection = r.intersected( Basis::at( erster ) );
+			return !( Basis::_hasIntersection = true );
+		}
+		// Der Intersector hat dabei jedes Rect geschnitten und zuletzt ein leeres behalten
+		if ( !Basis::isEmpty() ) Basis::_lastIntersection = {};
+		anhaengen( r );
+		return true;
+	}
+	void addAnyhow( R_type r ) override
+	{
+		// Das letzte überlappende Rect in Listenreihenfolge - wie im Intersector
+		if ( !Basis::_hasIntersection ) merkeLetzten( r, -1 );
+		anhaengen( r );
+	}
+	bool changeItem( int index, R_type newValue ) override
+	{
+		if ( Basis::at( index ) != newValue )
+		{
+			if ( indiziert() ) austragen( index );
+			Basis::operator[]( index ) = newValue;
+			if ( indiziert() ) eintragen( index );
+			if ( !Basis::_hasIntersection ) merkeLetzten( newValue, index );
+			Basis::_br |= newValue;
+		}
+		return !Basis::_hasIntersection;
+	}
+	void resetToFirst() override
+	{
+		Basis::resetToFirst();
+		reindex();
+	}
+	// Gitter aus der Liste neu aufbauen
+	void reindex()
+	{
+		_zellen.clear();
+		_stempel.fill( 0, Basis::count() );
+		if ( !indiziert() ) return;
+		if ( !_zelleFest )
+		{
+			qreal summe = 0.;
+			for ( const auto &r : std::as_const( *this ) )
+				summe += qMax( qAbs( qreal( r.width() ) ), qAbs( qreal( r.height() ) ) );
+			_zelle = qMax( qreal( 1. ), summe / Basis::count() );
+		}
+		for ( int i = 0; i < Basis::count(); ++i ) eintragen( i );
+	}
+
+  private:
+	QHash< quint64, QVarLengthArray< int, 4 > > _zellen;
+	QList< quint32 >							_stempel; // je Rect: zuletzt gesehen in Runde
+	quint32										_runde{ 0 };
+	qreal										_zelle;
+	bool										_zelleFest;
+
+	bool		   indiziert() const { return Basis::count() > LINEAR_MAX; }
+	static quint64 schluessel( qint32 x, qint32 y )
+	{
+		return quint64( quint32( x ) ) << 32 | quint32( y );
+	}
+	qint32 zelle( qreal v ) const { return qint32( std::floor( v / _zelle ) ); }
+	// Zellbereich eines Rects (inklusive)
+	void   bereich( const R_type &r, qint32 &x0, qint32 &y0, qint32 &x1, qint32 &y1 ) const
+	{
+		const auto n = r.normalized();
+		x0 = zelle( n.left() ), x1 = zelle( n.right() );
+		y0 = zelle( n.top() ), y1 = zelle( n.bottom() );
+	}
+	void eintragen( int i )
+	{
+		qint32 x0, y0, x1, y1;
+		bereich( Basis::at( i ), x0, y0, x1, y1 );
+		for ( auto x = x0; x <= x1; ++x )
+			for ( auto y = y0; y <= y1; ++y ) _zellen[ schluessel( x, y ) ].append( i );
+	}
+	void austragen( int i )
+	{
+		qint32 x0, y0, x1, y1;
+		bereich( Basis::at( i ), x0, y0, x1, y1 );
+		for ( auto x = x0; x <= x1; ++x )
+			for ( auto y = y0; y <= y1; ++y )
+			{
+				auto it = _zellen.find( schluessel( x, y ) );
+				if ( it == _zellen.end() ) continue;
+				it->removeOne( i );
+				if ( it->isEmpty() ) _zellen.erase( it );
+			}
+	}
+	void anhaengen( const R_type &r )
+	{
+		Basis::append( r );
+		Basis::_br |= r;
+		// Beim Überschreiten der Schwelle einmal alles eintragen, danach nur noch das Neue
+		if ( Basis::count() == LINEAR_MAX + 1 ) reindex();
+		else if ( indiziert() ) _stempel.append( 0 ), eintragen( Basis::count() - 1 );
+	}
+	// f( i ) für jedes Rect, das r überlappen könnte - jedes höchstens einmal, ohne "ausser"
+	template < class F >
+	void fuerKandidaten( const R_type &r, int ausser, F f )
+	{
+		if ( !indiziert() )
+		{
+			for ( int i = 0; i < Basis::count(); ++i )
+				if ( i != ausser ) f( i );
+			return;
+		}
+		// Außerhalb der Gesamt-Bounds liegt nichts
+		if ( !r.intersects( Basis::_br ) ) return;
+		if ( ++_runde == 0 ) _stempel.fill( 0 ), _runde = 1;
+		qint32 x0, y0, x1, y1;
+		bereich( r, x0, y0, x1, y1 );
+		for ( auto x = x0; x <= x1; ++x )
+			for ( auto y = y0; y <= y1; ++y )
+			{
+				auto it = _zellen.constFind( schluessel( x, y ) );
+				if ( it == _zellen.cend() ) continue;
+				for ( auto i : *it )
+					if ( i != ausser && _stempel[ i ] != _runde ) _stempel[ i ] = _runde, f( i );
+			}
+	}
+	void merkeLetzten( const R_type &r, int ausser )
+	{
+		int letzter = -1;
+		fuerKandidaten( r, ausser,
+						[ & ]( int i )
+						{
+							if ( i > letzter && r.intersects( Basis::at( i ) ) ) letzter = i;
+						} );
+		if ( letzter < 0 ) return;
+		Basis::_lastIntersection = r.intersected( Basis::at( letzter ) );
+		Basis::_hasIntersection	 = true;
+	}
+};
+
+// Intersector< QRectF, QPointF > mit SoA-Spiegel für die PieSimd-Überlappungskernels - gleiche
+// Semantik wie der IndexedIntersector.  ACHTUNG: Auch hier nur über add(), addAnyhow(),
+// changeItem(), resetToFirst() und clear() ändern, sonst danach sync() aufrufen.
+struct SimdIntersector : public Intersector< QRectF, QPointF >
+{
+	using Basis = Intersector< QRectF, QPointF >;
+	using Basis::changeItem;
+
+	void clear()
+	{
+		Basis::clear();
+		_lanes.clear();
+	}
+	bool add( QRectF r ) override
+	{
+		qreal c[ 4 ];
+		if ( kanten( r, c ) )
+			if ( auto i = PieSimd::kernels().firstOverlap( _lanes, c ); i >= 0 )
+			{
+				_lastIntersection = r.intersected( at( i ) );
+				return !( _hasIntersection = true );
+			}
+		// wie im Intersector: kein Treffer hinterlässt ein leeres Schnitt-Rect
+		if ( !isEmpty() ) _lastIntersection = {};
+		anhaengen( r );
+		return true;
+	}
+	void addAnyhow( QRectF r ) override
+	{
+		if ( !_hasIntersection ) merkeLetzten( r, -1 );
+		anhaengen( r );
+	}
+	bool changeItem( int index, QRectF newValue ) override
+	{
+		if ( at( index ) != newValue )
+		{
+			operator[]( index ) = newValue;
+			_lanes.set( index, newValue );
+			if ( !_hasIntersection ) merkeLetzten( newValue, index );
+			_br |= newValue;
+		}
+		return !_hasIntersection;
+	}
+	void resetToFirst() override
+	{
+		Basis::resetToFirst();
+		_lanes.resize( 1 );
+	}
+	// Lanes aus der Liste neu aufbauen
+	void sync()
+	{
+		_lanes.clear();
+		for ( const auto &r : std::as_const( *this ) ) _lanes.append( r );
+	}
+
+  private:
+	PieRectFLanes _lanes;
+
+	// Kanten für die Kernels - false für leere Rects, die nichts überlappen
+	static bool	  kanten( const QRectF &r, qreal *c )
+	{
+		const auto n = r.normalized();
+		c[ 0 ] = n.left(), c[ 1 ] = n.top(), c[ 2 ] = n.right(), c[ 3 ] = n.bottom();
+		return n.width() > 0. && n.height() > 0.;
+	}
+	void anhaengen( const QRectF &r )
+	{
+		append( r );
+		_lanes.append( r );
+		_br |= r;
+	}
+	void merkeLetzten( const QRectF &r, int ausser )
+	{
+		qreal c[ 4 ];
+		if ( !kanten( r, c ) ) return;
+		const auto &k = PieSimd::kernels();
+		auto		i = k.lastOverlap( _lanes, c, count() );
+		if ( i >= 0 && i == ausser ) i = k.lastOverlap( _lanes, c, ausser );
+		if ( i < 0 ) return;
+		_lastIntersection = r.intersected( at( i ) );
+		_hasIntersection  = true;
+	}
+};
@@ -0,0 +1,97 @@
+/******************************************************************************
+ * pielatency.cpp - Reaktionszeiten der Pies als Histogramm
+ * ========================================================
+ * Author: Stefan <St0fF / the0bsessedManiacs> Kaps
+ ******************************************************************************
+ *  Diese Datei ist Teil von PieMenuTesting.
+ *
+ *  PieMenuTesting ist Freie Software: Sie können es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Wahl) jeder neueren
+ *  veröffentlichten Version, weiter verteilen und/oder modifizieren.
+ *
+ *  PieMenuTesting wird in der Hoffnung, dass es nützlich sein wird, aber
+ *  OHNE JEDE GEWÄHRLEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewährleistung der MARKTFÄHIGKEIT oder EIGNUNG FÜR EINEN BESTIMMTEN ZWECK.
+ *  Siehe die GNU General Public License für weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <https://www.gnu.org/licenses/>.
+ *****************************************************************************/
+#include "pielatency.h"
+
+#include <QJsonArray>
+#include <bit>
+#include <cmath>
+
+int PieLatencyHistogram::bucket( qint64 us )
+{
+	us = qBound( 0ll, us, ( 2ll << MaxExp ) - 1 );
+	if ( us < Linear ) return int( us );
+	// Exponent und die SubBits Bits direkt unter der führenden 1
+	int e = std::bit_width( quint64( us ) ) - 1;
+	return Linear + ( e - SubBits - 1 ) * ( 1 << SubBits )
+		 + int( ( us >> ( e - SubBits ) ) & ( ( 1 << SubBits ) - 1 ) );
+}
+
+qint64 PieLatencyHistogram::upperUs( int b )
+{
+	if ( b < Linear ) return b;
+	int	 e	 = ( b - Linear ) / ( 1 << SubBits ) + SubBits + 1;
+	auto sub = ( b - Linear ) % ( 1 << SubBits );
+	return ( ( ( 1ll << SubBits ) + sub + 1 ) << ( e - SubBits ) ) - 1;
+}
+
+void PieLatencyHistogram::record( qint64 ns )
+{
+	auto us = qMax( 0ll, ns / 1000 );
+	_b[ bucket( us ) ].fetch_add( 1, std::memory_order_relaxed );
+	_sumUs.fetch_add( us, std::memory_order_relaxed );
+	for ( auto m = _maxUs.load( std::memory_order_relaxed );
+		  us > m && !_maxUs.compare_exchange_weak( m, us, std::memory_order_relaxed ); )
+		;
+}
+
+void PieLatencyHistogram::reset()
+{
+	for ( auto &b : _b ) b.store( 0, std::memory_order_relaxed );
+	_sumUs.store( 0, std::memory_order_relaxed ), _maxUs.store( 0, std::memory_order_relaxed );
+}
+
+quint64 PieLatencyHistogram::count() const
+{
+	quint64 n = 0;
+	for ( const auto &b : _b ) n += b.load( std::memory_order_relaxed );
+	return n;
+}
+
+qint64 PieLatencyHistogram::percentileUs( qreal p ) const
+{
+	// Ohne Sperre ist das keine exakte Momentaufnahme - einzelne Messwerte, die während des
+	// Lesens dazukommen, verschieben das Ergebnis höchstens um einen Bucket.
+	std::array< quint64, BucketCount > b;
+	quint64							   n = 0;
+	for ( int i = 0; i < BucketCount; ++i ) n += b[ i ] = _b[ i ].load( std::memory_order_relaxed );
+	if ( !n ) return 0;
+	auto rang = qMax( 1ull, quint64( std::ceil( qBound( 0., p, 1. ) * n ) ) );
+	for ( int i = 0; i < BucketCount; ++i )
+		if ( b[ i ] >= rang ) return upperUs( i );
+		else rang -= b[ i ];
+	return maxUs();
+}
+
+QJsonObject PieLatencyHistogram::toJson() const
+{
+	QJsonArray buckets;
+	for ( int i = 0; i < BucketCount; ++i )
+		if ( auto n = _b[ i ].load( std::memory_order_relaxed ) )
+			buckets.append( QJsonArray{ upperUs( i ), qint64( n ) } );
+	auto n = count();
+	return { { "count", qint64( n ) },
+			 { "p50_us", percentileUs( 0.5 ) },
+			 { "p95_us", percentileUs( 0.95 ) },
+			 { "p99_us", percentileUs( 0.99 ) },
+			 { "max_us", maxUs() },
+			 { "mean_us", n ? qreal( _sumUs.load( std::memory_order_relaxed ) ) / n : 0. },
+			 { "buckets", buckets } };
+}
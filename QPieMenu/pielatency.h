@@ -0,0 +1,57 @@
+/******************************************************************************
+ * pielatency.h - Reaktionszeiten der Pies als Histogramm
+ * ======================================================
+ * Author: Stefan <St0fF / the0bsessedManiacs> Kaps
+ ******************************************************************************
+ *  Diese Datei ist Teil von PieMenuTesting.
+ *
+ *  PieMenuTesting ist Freie Software: Sie können es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Wahl) jeder neueren
+ *  veröffentlichten Version, weiter verteilen und/oder modifizieren.
+ *
+ *  PieMenuTesting wird in der Hoffnung, dass es nützlich sein wird, aber
+ *  OHNE JEDE GEWÄHRLEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewährleistung der MARKTFÄHIGKEIT oder EIGNUNG FÜR EINEN BESTIMMTEN ZWECK.
+ *  Siehe die GNU General Public License für weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <https://www.gnu.org/licenses/>.
+ ******************************************************************************
+ * Gemessen wird vom Eingang eines Maus- oder Tastatur-Events bis zum Ende des paintEvent, das die
+ * ausgelöste Zustandsänderung zeigt.  Geschrieben wird nur im GUI-Thread, gelesen werden darf von
+ * überall (Telemetrie) - deshalb sind alle Zähler atomar und es wird nie gesperrt.
+ *
+ * Die Buckets sind logarithmisch in Mikrosekunden: bis 15 µs je 1 µs, danach 8 Stufen je
+ * Zweierpotenz.  Ein Quantil ist damit auf höchstens 12,5 % genau - für p50/p95/p99 reicht das.
+ *****************************************************************************/
+#pragma once
+
+#include <QJsonObject>
+#include <array>
+#include <atomic>
+
+class PieLatencyHistogram
+{
+  public:
+	static constexpr int SubBits	 = 3;
+	static constexpr int Linear		 = 2 << SubBits;
+	static constexpr int MaxExp		 = 30; // 2^31 µs sind gut 35 Minuten
+	static constexpr int BucketCount = Linear + ( MaxExp - SubBits ) * ( 1 << SubBits );
+
+	void				 record( qint64 ns );
+	void				 reset();
+	quint64				 count() const;
+	// Obergrenze (µs) des Buckets, in dem das p-Quantil (0..1) liegt - 0 ohne Messwerte
+	qint64				 percentileUs( qreal p ) const;
+	qint64				 maxUs() const { return _maxUs.load( std::memory_order_relaxed ); }
+	// count, p50/p95/p99/max in µs, Mittelwert und alle belegten Buckets als [Obergrenze, Anzahl]
+	QJsonObject			 toJson() const;
+
+	static int			 bucket( qint64 us );
+	static qint64		 upperUs( int bucket );
+
+  private:
+	std::array< std::atomic< quint64 >, BucketCount > _b{};
+	std::atomic< qint64 >							  _sumUs{ 0 }, _maxUs{ 0 };
+};
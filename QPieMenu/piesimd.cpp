@@ -0,0 +1,498 @@
+/******************************************************************************
+ * piesimd.cpp - Kernel-Auswahl, Scalar- und SSE2-Kernels
+ * =======================================================
+ * Author: Stefan <St0fF / the0bsessedManiacs> Kaps
+ ******************************************************************************
+ *  Diese Datei ist Teil von PieMenuTesting.
+ *
+ *  PieMenuTesting ist Freie Software: Sie können es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Wahl) jeder neueren
+ *  veröffentlichten Version, weiter verteilen und/oder modifizieren.
+ *
+ *  PieMenuTesting wird in der Hoffnung, dass es nützlich sein wird, aber
+ *  OHNE JEDE GEWÄHRLEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewährleistung der MARKTFÄHIGKEIT oder EIGNUNG FÜR EINEN BESTIMMTEN ZWECK.
+ *  Siehe die GNU General Public License für weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <https://www.gnu.org/licenses/>.
+ *****************************************************************************/
+#include "piesimd.h"
+
+#include <QByteArray>
+#include <QDebug>
+#include <bit>
+#include <cmath>
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#	define PIE_SIMD_SSE2
+#	include <emmintrin.h>
+#endif
+#if defined( Q_PROCESSOR_X86 ) && defined( _MSC_VER )
+#	include <intrin.h>
+#endif
+
+namespace PieSimd
+{
+#ifdef PIE_SIMD_AVX2
+	extern const Kernels avx2Kernels;
+#endif
+#ifdef PIE_SIMD_AVX512
+	extern const Kernels avx512Kernels;
+#endif
+} // namespace PieSimd
+
+void SPLanes::resize( int n )
+{
+	count  = n;
+	stride = ( n + width - 1 ) & ~( width - 1 );
+	if ( LaneCount * stride > capacity )
+	{
+		capacity = LaneCount * stride;
+		buf.reset( new ( std::align_val_t{ align } ) qreal[ capacity ] );
+	}
+}
+
+void PieRectLanes::resize( int n )
+{
+	count  = n;
+	stride = ( n + width - 1 ) & ~( width - 1 );
+	if ( LaneCount * stride > capacity )
+	{
+		capacity = LaneCount * stride;
+		buf.reset( new ( std::align_val_t{ align } ) qint32[ capacity ] );
+	}
+	std::fill_n( buf.get(), SkipSep * stride, 0 );
+	for ( auto l : { SkipSep, SkipPad } )
+	{
+		std::fill_n( ( *this )[ l ], count, keep );
+		std::fill_n( ( *this )[ l ] + count, stride - count, skip );
+	}
+}
+
+void PieRectFLanes::resize( int n )
+{
+	if ( n > stride )
+	{
+		// verdoppeln - der SimdIntersector hängt einzeln an
+		int neu = qMax( width, stride );
+		while ( neu < n ) neu *= 2;
+		std::unique_ptr< qreal[], Free > alt( std::move( buf ) );
+		buf.reset( new ( std::align_val_t{ align } ) qreal[ LaneCount * neu ] );
+		for ( int l = 0; l < LaneCount; ++l )
+		{
+			auto ziel = buf.get() + l * neu;
+			if ( count ) std::copy_n( alt.get() + l * stride, count, ziel );
+			std::fill_n( ziel + count, neu - count, l < R ? leer : -leer );
+		}
+		stride = neu;
+	} else if ( n < count )
+		for ( int l = 0; l < LaneCount; ++l )
+			std::fill_n( ( *this )[ Lane( l ) ] + n, count - n, l < R ? leer : -leer );
+	count = n;
+}
+
+#pragma region( Scalar )
+// Die Referenz: dieselbe Rechnung wie QRect::setSize( ( s * size ).toSize() ) gefolgt von
+// QRect::moveCenter( ( r * qSinCos( a ) ).toPoint() ) - gerundet wird also mit qRound.
+static void interpolateScalar( SPLanes &l, qreal t, QRect *rects, QPointF *opaScale )
+{
+	for ( int i = 0, cnt = l.count; i < cnt; ++i )
+	{
+		auto  t0  = l[ SPLanes::T0 ][ i ], t1 = l[ SPLanes::T1 ][ i ];
+		auto  x	  = qMax( 0., qMin( 1., ( t - t0 ) / ( t1 - t0 ) ) );
+		auto  sst = x * x * ( 3. - 2. * x );
+		qreal cv[ 4 ];
+		for ( int k = 0; k < 4; ++k )
+		{
+			auto q = l[ SPLanes::Lane( SPLanes::QR + k ) ][ i ];
+			auto z = l[ SPLanes::Lane( SPLanes::ZR + k ) ][ i ];
+			cv[ k ] = z * sst - q * sst + q;
+			l[ SPLanes::Lane( SPLanes::CR + k ) ][ i ] = cv[ k ];
+		}
+		int cx = qRound( cv[ 0 ] * std::sin( cv[ 1 ] ) );
+		int cy = qRound( cv[ 0 ] * std::cos( cv[ 1 ] ) );
+		int w1 = qRound( cv[ 3 ] * l[ SPLanes::W ][ i ] ) - 1;
+		int h1 = qRound( cv[ 3 ] * l[ SPLanes::H ][ i ] ) - 1;
+		int x1 = cx - w1 / 2, y1 = cy - h1 / 2;
+		rects[ i ].setCoords( x1, y1, x1 + w1, y1 + h1 );
+		opaScale[ i ] = { cv[ 2 ], cv[ 3 ] };
+	}
+}
+
+static void lerp4Scalar( qreal t, const qreal *a, const qreal *b, qreal *out )
+{
+	for ( int k = 0; k < 4; ++k ) out[ k ] = b[ k ] * t - a[ k ] * t + a[ k ];
+}
+
+static quint64 lerpRgba64Scalar( quint64 a, quint64 b, qreal t )
+{
+	t			= qMax( 0., qMin( 1., t ) );
+	quint64 res = 0;
+	for ( int k = 0; k < 64; k += 16 )
+	{
+		qreal c0 = qreal( ( a >> k ) & 0xffff ), c1 = qreal( ( b >> k ) & 0xffff );
+		res |= quint64( std::nearbyint( c1 * t - c0 * t + c0 ) ) << k;
+	}
+	return res;
+}
+
+static int minBoxDistanceScalar( const PieRectLanes &r, PieRectLanes::Lane skip, QPoint p,
+								 int *dist )
+{
+	const qint32 *l = r[ PieRectLanes::L ], *t = r[ PieRectLanes::T ], *rr = r[ PieRectLanes::R ],
+				 *b = r[ PieRectLanes::B ], *s = r[ skip ];
+	int md = PieRectLanes::skip, id = -1;
+	for ( int i = 0; i < r.count; ++i )
+	{
+		int d = qMax( qMax( qMax( l[ i ] - p.x(), p.x() - rr[ i ] ),
+							qMax( t[ i ] - p.y(), p.y() - b[ i ] ) ),
+					  s[ i ] );
+		if ( d < md ) md = d, id = i;
+	}
+	*dist = md;
+	return md == PieRectLanes::skip ? -1 : id;
+}
+
+static inline bool overlapScalar( const PieRectFLanes &r, const qreal *c, int i )
+{
+	return c[ 0 ] < r[ PieRectFLanes::R ][ i ] && r[ PieRectFLanes::L ][ i ] < c[ 2 ]
+		&& c[ 1 ] < r[ PieRectFLanes::B ][ i ] && r[ PieRectFLanes::T ][ i ] < c[ 3 ];
+}
+static int firstOverlapScalar( const PieRectFLanes &r, const qreal *c )
+{
+	for ( int i = 0; i < r.count; ++i )
+		if ( overlapScalar( r, c, i ) ) return i;
+	return -1;
+}
+static int lastOverlapScalar( const PieRectFLanes &r, const qreal *c, int bis )
+{
+	for ( int i = bis; --i >= 0; )
+		if ( overlapScalar( r, c, i ) ) return i;
+	return -1;
+}
+#pragma endregion
+#pragma region( SSE2 )
+#ifdef PIE_SIMD_SSE2
+// SSE2 kennt weder FMA noch blendv oder round - alles wird mit and/andnot/or und der Trunkierung
+// nachgebaut.  Dafür ist es auf jedem x86-64 vorhanden.
+static inline __m128d sel2( __m128d m, __m128d a, __m128d b )
+{
+	return _mm_or_pd( _mm_and_pd( m, b ), _mm_andnot_pd( m, a ) );
+}
+
+// sin und cos für 2 Winkel, gleiche Reduktion und Polynome wie die AVX-Varianten
+static inline void sinCos2( __m128d x, __m128d &s, __m128d &c )
+{
+	const auto qi = _mm_cvtpd_epi32( _mm_mul_pd( x, _mm_set1_pd( M_2_PI ) ) ); // rundet zur Nähe
+	const auto q  = _mm_cvtepi32_pd( qi );
+	auto	   r  = _mm_sub_pd( x, _mm_mul_pd( q, _mm_set1_pd( 1.57079632673412561417e+00 ) ) );
+	r			  = _mm_sub_pd( r, _mm_mul_pd( q, _mm_set1_pd( 6.07710050630396597660e-11 ) ) );
+	r			  = _mm_sub_pd( r, _mm_mul_pd( q, _mm_set1_pd( 2.02226624879595063154e-21 ) ) );
+	const auto z  = _mm_mul_pd( r, r );
+	auto	   ps = _mm_set1_pd( 1.58962301576546568060e-10 );
+	ps = _mm_add_pd( _mm_mul_pd( ps, z ), _mm_set1_pd( -2.50507477628578072866e-8 ) );
+	ps = _mm_add_pd( _mm_mul_pd( ps, z ), _mm_set1_pd( 2.75573136213857245213e-6 ) );
+	ps = _mm_add_pd( _mm_mul_pd( ps, z ), _mm_set1_pd( -1.98412698295895385996e-4 ) );
+	ps = _mm_add_pd( _mm_mul_pd( ps, z ), _mm_set1_pd( 8.33333333332211858878e-3 ) );
+	ps = _mm_add_pd( _mm_mul_pd( ps, z ), _mm_set1_pd( -1.66666666666666307295e-1 ) );
+	ps = _mm_add_pd( _mm_mul_pd( _mm_mul_pd( ps, z ), r ), r );
+	auto pc = _mm_set1_pd( -1.13585365213876817300e-11 );
+	pc = _mm_add_pd( _mm_mul_pd( pc, z ), _mm_set1_pd( 2.08757008419747316778e-9 ) );
+	pc = _mm_add_pd( _mm_mul_pd( pc, z ), _mm_set1_pd( -2.75573141792967388112e-7 ) );
+	pc = _mm_add_pd( _mm_mul_pd( pc, z ), _mm_set1_pd( 2.48015872888517045348e-5 ) );
+	pc = _mm_add_pd( _mm_mul_pd( pc, z ), _mm_set1_pd( -1.38888888888730564116e-3 ) );
+	pc = _mm_add_pd( _mm_mul_pd( pc, z ), _mm_set1_pd( 4.16666666666665929218e-2 ) );
+	pc = _mm_add_pd( _mm_mul_pd( _mm_mul_pd( pc, z ), z ),
+					 _mm_sub_pd( _mm_set1_pd( 1. ), _mm_mul_pd( _mm_set1_pd( 0.5 ), z ) ) );
+	// Quadrant wie gehabt aus den unteren Bits - q steht doppelt in jeder 64-Bit-Lane
+	const auto qq  = _mm_unpacklo_epi32( qi, qi );
+	const auto one = _mm_set1_epi32( 1 );
+	const auto two = _mm_set1_epi64x( 2 );
+	const auto swp = _mm_castsi128_pd( _mm_cmpeq_epi32( _mm_and_si128( qq, one ), one ) );
+	const auto ngs = _mm_castsi128_pd( _mm_slli_epi64( _mm_and_si128( qq, two ), 62 ) );
+	const auto ngc = _mm_castsi128_pd( _mm_slli_epi64(
+		_mm_and_si128( _mm_add_epi64( qq, _mm_set1_epi64x( 1 ) ), two ), 62 ) );
+	s			   = _mm_xor_pd( sel2( swp, ps, pc ), ngs );
+	c			   = _mm_xor_pd( sel2( swp, pc, ps ), ngc );
+}
+// qRound() für 2 doubles -> 2 ints (Lanes 0 und 1).  Wie bei Qt halb weg von 0: v +/- 0.5, dann
+// abgeschnitten - die 0.5 bekommt dafür das Vorzeichen von v.
+static inline __m128i round2( __m128d v )
+{
+	const auto h = _mm_or_pd( _mm_set1_pd( 0.5 ), _mm_and_pd( v, _mm_set1_pd( -0. ) ) );
+	return _mm_cvttpd_epi32( _mm_add_pd( v, h ) );
+}
+// Ganzzahl-Division durch 2 mit Rundung gegen 0 (wie "w / 2" in QRect::moveCenter)
+static inline __m128i half2( __m128i v )
+{
+	return _mm_srai_epi32( _mm_add_epi32( v, _mm_srli_epi32( v, 31 ) ), 1 );
+}
+
+static void interpolateSSE2( SPLanes &l, qreal t, QRect *rects, QPointF *opaScale )
+{
+	const auto _t = _mm_set1_pd( t ), n0 = _mm_setzero_pd(), n1 = _mm_set1_pd( 1. );
+	const auto i1 = _mm_set1_epi32( 1 );
+	for ( int i = 0, cnt = l.count; i < cnt; i += 2 )
+	{
+		auto t0	 = _mm_load_pd( l[ SPLanes::T0 ] + i );
+		auto t1	 = _mm_load_pd( l[ SPLanes::T1 ] + i );
+		auto x	 = _mm_div_pd( _mm_sub_pd( _t, t0 ), _mm_sub_pd( t1, t0 ) );
+		x		 = _mm_max_pd( n0, _mm_min_pd( n1, x ) );
+		auto sst = _mm_mul_pd( _mm_mul_pd( x, x ),
+							   _mm_sub_pd( _mm_set1_pd( 3. ), _mm_add_pd( x, x ) ) );
+		__m128d cv[ 4 ];
+		for ( int k = 0; k < 4; ++k )
+		{
+			auto q	= _mm_load_pd( l[ SPLanes::Lane( SPLanes::QR + k ) ] + i );
+			auto z	= _mm_load_pd( l[ SPLanes::Lane( SPLanes::ZR + k ) ] + i );
+			cv[ k ] = _mm_add_pd( _mm_sub_pd( _mm_mul_pd( z, sst ), _mm_mul_pd( q, sst ) ), q );
+			_mm_store_pd( l[ SPLanes::Lane( SPLanes::CR + k ) ] + i, cv[ k ] );
+		}
+		__m128d sn, cs;
+		sinCos2( cv[ 1 ], sn, cs );
+		auto cx = round2( _mm_mul_pd( cv[ 0 ], sn ) );
+		auto cy = round2( _mm_mul_pd( cv[ 0 ], cs ) );
+		auto w1 = _mm_sub_epi32(
+			round2( _mm_mul_pd( cv[ 3 ], _mm_load_pd( l[ SPLanes::W ] + i ) ) ), i1 );
+		auto h1 = _mm_sub_epi32(
+			round2( _mm_mul_pd( cv[ 3 ], _mm_load_pd( l[ SPLanes::H ] + i ) ) ), i1 );
+		auto x1 = _mm_sub_epi32( cx, half2( w1 ) ), y1 = _mm_sub_epi32( cy, half2( h1 ) );
+		auto a0 = _mm_unpacklo_epi32( x1, y1 );
+		auto b0 = _mm_unpacklo_epi32( _mm_add_epi32( x1, w1 ), _mm_add_epi32( y1, h1 ) );
+		_mm_storeu_si128( reinterpret_cast< __m128i * >( rects + i ),
+						  _mm_unpacklo_epi64( a0, b0 ) );
+		_mm_storeu_pd( reinterpret_cast< qreal * >( opaScale + i ),
+					   _mm_unpacklo_pd( cv[ 2 ], cv[ 3 ] ) );
+		if ( Q_LIKELY( i + 1 < cnt ) )
+		{
+			_mm_storeu_si128( reinterpret_cast< __m128i * >( rects + i + 1 ),
+							  _mm_unpackhi_epi64( a0, b0 ) );
+			_mm_storeu_pd( reinterpret_cast< qreal * >( opaScale + i + 1 ),
+						   _mm_unpackhi_pd( cv[ 2 ], cv[ 3 ] ) );
+		}
+	}
+}
+
+static void lerp4SSE2( qreal t, const qreal *a, const qreal *b, qreal *out )
+{
+	const auto _t = _mm_set1_pd( t );
+	for ( int k = 0; k < 4; k += 2 )
+	{
+		auto a0 = _mm_loadu_pd( a + k ), b0 = _mm_loadu_pd( b + k );
+		_mm_storeu_pd( out + k,
+					   _mm_add_pd( _mm_sub_pd( _mm_mul_pd( b0, _t ), _mm_mul_pd( a0, _t ) ), a0 ) );
+	}
+}
+
+// _mm_cvtsi64_si128 & Co. gibt es nur auf x86-64 - über den Speicher geht's auch mit 32 Bit
+static inline __m128i load64( const quint64 &v )
+{
+	return _mm_loadl_epi64( reinterpret_cast< const __m128i * >( &v ) );
+}
+
+static inline quint64 store64( __m128i v )
+{
+	quint64 r;
+	_mm_storel_epi64( reinterpret_cast< __m128i * >( &r ), v );
+	return r;
+}
+
+static quint64 lerpRgba64SSE2( quint64 a, quint64 b, qreal t )
+{
+	const auto zero = _mm_setzero_si128();
+	const auto _t	= _mm_set1_pd( qMax( 0., qMin( 1., t ) ) );
+	// 4 x 16 Bit -> 4 x 32 Bit -> 2 x 2 doubles
+	auto	   ca	= _mm_unpacklo_epi16( load64( a ), zero );
+	auto	   cb	= _mm_unpacklo_epi16( load64( b ), zero );
+	__m128i	   r[ 2 ];
+	for ( int k = 0; k < 2; ++k )
+	{
+		auto a0 = _mm_cvtepi32_pd( ca ), b0 = _mm_cvtepi32_pd( cb );
+		r[ k ]	= _mm_cvtpd_epi32(
+			 _mm_add_pd( _mm_sub_pd( _mm_mul_pd( b0, _t ), _mm_mul_pd( a0, _t ) ), a0 ) );
+		ca = _mm_srli_si128( ca, 8 ), cb = _mm_srli_si128( cb, 8 );
+	}
+	// packs sättigt vorzeichenbehaftet - also um 0x8000 verschieben und wieder zurück
+	const auto bias = _mm_set1_epi32( 0x8000 );
+	auto	   res	= _mm_sub_epi32( _mm_unpacklo_epi64( r[ 0 ], r[ 1 ] ), bias );
+	res				= _mm_xor_si128( _mm_packs_epi32( res, res ), _mm_set1_epi16( -0x8000 ) );
+	return store64( res );
+}
+
+// SSE2 kennt noch kein _mm_max_epi32 (erst SSE4.1)
+static inline __m128i max4( __m128i a, __m128i b )
+{
+	auto m = _mm_cmpgt_epi32( a, b );
+	return _mm_or_si128( _mm_and_si128( m, a ), _mm_andnot_si128( m, b ) );
+}
+
+static int minBoxDistanceSSE2( const PieRectLanes &r, PieRectLanes::Lane skip, QPoint p,
+							   int *dist )
+{
+	const auto px = _mm_set1_epi32( p.x() ), py = _mm_set1_epi32( p.y() );
+	const auto vier = _mm_set1_epi32( 4 );
+	auto	   best = _mm_set1_epi32( PieRectLanes::skip ), bestI = _mm_set1_epi32( -1 );
+	auto	   idx	= _mm_setr_epi32( 0, 1, 2, 3 );
+	for ( int i = 0; i < r.stride; i += 4, idx = _mm_add_epi32( idx, vier ) )
+	{
+		auto ld = [ & ]( PieRectLanes::Lane l ) {
+			return _mm_load_si128( reinterpret_cast< const __m128i * >( r[ l ] + i ) );
+		};
+		auto d = max4( max4( _mm_sub_epi32( ld( PieRectLanes::L ), px ),
+							 _mm_sub_epi32( px, ld( PieRectLanes::R ) ) ),
+					   max4( _mm_sub_epi32( ld( PieRectLanes::T ), py ),
+							 _mm_sub_epi32( py, ld( PieRectLanes::B ) ) ) );
+		d	   = max4( d, ld( skip ) );
+		// nur echt kleiner übernehmen -> je Lane bleibt der kleinste Index stehen
+		auto m = _mm_cmpgt_epi32( best, d );
+		best   = _mm_or_si128( _mm_and_si128( m, d ), _mm_andnot_si128( m, best ) );
+		bestI  = _mm_or_si128( _mm_and_si128( m, idx ), _mm_andnot_si128( m, bestI ) );
+	}
+	alignas( 16 ) qint32 bd[ 4 ], bi[ 4 ];
+	_mm_store_si128( reinterpret_cast< __m128i * >( bd ), best );
+	_mm_store_si128( reinterpret_cast< __m128i * >( bi ), bestI );
+	return PieSimd::minLane( bd, bi, 4, dist );
+}
+
+// Bit k gesetzt: das Rect in Lane i + k überlappt c
+static inline unsigned overlap2( const PieRectFLanes &r, const __m128d *c, int i )
+{
+	auto ld = [ & ]( PieRectFLanes::Lane l ) { return _mm_load_pd( r[ l ] + i ); };
+	auto m	= _mm_and_pd( _mm_cmplt_pd( c[ 0 ], ld( PieRectFLanes::R ) ),
+						  _mm_cmplt_pd( ld( PieRectFLanes::L ), c[ 2 ] ) );
+	m		= _mm_and_pd( m, _mm_cmplt_pd( c[ 1 ], ld( PieRectFLanes::B ) ) );
+	m		= _mm_and_pd( m, _mm_cmplt_pd( ld( PieRectFLanes::T ), c[ 3 ] ) );
+	return unsigned( _mm_movemask_pd( m ) );
+}
+
+static int firstOverlapSSE2( const PieRectFLanes &r, const qreal *c )
+{
+	const __m128d cc[ 4 ] = { _mm_set1_pd( c[ 0 ] ), _mm_set1_pd( c[ 1 ] ), _mm_set1_pd( c[ 2 ] ),
+							  _mm_set1_pd( c[ 3 ] ) };
+	for ( int i = 0; i < r.count; i += 2 )
+		if ( auto m = overlap2( r, cc, i ) ) return i + std::countr_zero( m );
+	return -1;
+}
+
+static int lastOverlapSSE2( const PieRectFLanes &r, const qreal *c, int bis )
+{
+	const __m128d cc[ 4 ] = { _mm_set1_pd( c[ 0 ] ), _mm_set1_pd( c[ 1 ] ), _mm_set1_pd( c[ 2 ] ),
+							  _mm_set1_pd( c[ 3 ] ) };
+	for ( int i = ( bis - 1 ) & ~1; i >= 0; i -= 2 )
+	{
+		// nur im ersten Register können Lanes ab bis liegen
+		const unsigned gueltig = bis - i >= 2 ? 3u : ( 1u << ( bis - i ) ) - 1;
+		if ( auto m = overlap2( r, cc, i ) & gueltig ) return i + std::bit_width( m ) - 1;
+	}
+	return -1;
+}
+#endif
+#pragma endregion
+#pragma region( Auswahl )
+namespace PieSimd
+{
+	static const Kernels scalarKernels{ Level::Scalar, "scalar", interpolateScalar, lerp4Scalar,
+										lerpRgba64Scalar, minBoxDistanceScalar, firstOverlapScalar,
+										lastOverlapScalar };
+#ifdef PIE_SIMD_SSE2
+	static const Kernels sse2Kernels{ Level::SSE2, "sse2", interpolateSSE2, lerp4SSE2,
+									  lerpRgba64SSE2, minBoxDistanceSSE2, firstOverlapSSE2,
+									  lastOverlapSSE2 };
+#endif
+
+	// Was der Build hergibt, nach Stufe sortiert
+	static const Kernels *built( Level l )
+	{
+		switch ( l )
+		{
+			case Level::Scalar: return &scalarKernels;
+#ifdef PIE_SIMD_SSE2
+			case Level::SSE2: return &sse2Kernels;
+#endif
+#ifdef PIE_SIMD_AVX2
+			case Level::AVX2: return &avx2Kernels;
+#endif
+#ifdef PIE_SIMD_AVX512
+			case Level::AVX512: return &avx512Kernels;
+#endif
+			default: return nullptr;
+		}
+	}
+
+	// Was die CPU (und das Betriebssystem - die YMM/ZMM-Register müssen auch gesichert werden)
+	// kann.
+	static Level detectCpu()
+	{
+#if defined( Q_PROCESSOR_X86 ) && ( defined( __GNUC__ ) || defined( __clang__ ) )
+		__builtin_cpu_init();
+		if ( __builtin_cpu_supports( "avx512f" ) ) return Level::AVX512;
+		if ( __builtin_cpu_supports( "avx2" ) && __builtin_cpu_supports( "fma" ) )
+			return Level::AVX2;
+		if ( __builtin_cpu_supports( "sse2" ) ) return Level::SSE2;
+#elif defined( Q_PROCESSOR_X86 ) && defined( _MSC_VER )
+		int r[ 4 ];
+		__cpuid( r, 0 );
+		const int maxLeaf = r[ 0 ];
+		__cpuid( r, 1 );
+		const bool sse2 = r[ 3 ] & ( 1 << 26 ), fma = r[ 2 ] & ( 1 << 12 );
+		const bool avx = r[ 2 ] & ( 1 << 28 ), osxsave = r[ 2 ] & ( 1 << 27 );
+		const auto xcr0 = osxsave ? _xgetbv( 0 ) : 0ull;
+		bool	   avx2 = false, avx512f = false;
+		if ( maxLeaf >= 7 )
+		{
+			__cpuidex( r, 7, 0 );
+			avx2 = r[ 1 ] & ( 1 << 5 ), avx512f = r[ 1 ] & ( 1 << 16 );
+		}
+		if ( avx512f && ( xcr0 & 0xe6 ) == 0xe6 ) return Level::AVX512;
+		if ( avx2 && avx && fma && ( xcr0 & 0x6 ) == 0x6 ) return Level::AVX2;
+		if ( sse2 ) return Level::SSE2;
+#endif
+		return Level::Scalar;
+	}
+
+	static Level fromName( const QByteArray &n, Level fallback )
+	{
+		for ( auto l : { Level::Scalar, Level::SSE2, Level::AVX2, Level::AVX512 } )
+			if ( n == levelName( l ) ) return l;
+		return fallback;
+	}
+
+	Level supported()
+	{
+		static const Level s = [] {
+			auto l = detectCpu();
+			while ( l != Level::Scalar && !built( l ) ) l = Level( int( l ) - 1 );
+			return l;
+		}();
+		return s;
+	}
+
+	const Kernels *kernels( Level l )
+	{
+		return ( l <= supported() ) ? built( l ) : nullptr;
+	}
+
+	const Kernels &kernels()
+	{
+		static const Kernels *k = [] {
+			auto l = fromName( qgetenv( "PIEMENU_SIMD" ).toLower(), supported() );
+			l	   = qMin( l, supported() );
+			while ( !built( l ) ) l = Level( int( l ) - 1 );
+#ifdef DEBUG_EVENTS
+			qDebug() << "QPieMenu: SIMD-Kernels" << built( l )->name << "( CPU kann"
+					 << levelName( supported() ) << ")";
+#endif
+			return built( l );
+		}();
+		return *k;
+	}
+
+	const char *levelName( Level l )
+	{
+		constexpr const char *n[] = { "scalar", "sse2", "avx2", "avx512" };
+		return n[ int( l ) ];
+	}
+} // namespace PieSimd
+#pragma endregion
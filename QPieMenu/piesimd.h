@@ -0,0 +1,221 @@
+/******************************************************************************
+ * piesimd.h - SIMD-Kernels für QPieMenu, Auswahl zur Laufzeit
+ * ============================================================
+ * Author: Stefan <St0fF / the0bsessedManiacs> Kaps
+ ******************************************************************************
+ *  Diese Datei ist Teil von PieMenuTesting.
+ *
+ *  PieMenuTesting ist Freie Software: Sie können es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Wahl) jeder neueren
+ *  veröffentlichten Version, weiter verteilen und/oder modifizieren.
+ *
+ *  PieMenuTesting wird in der Hoffnung, dass es nützlich sein wird, aber
+ *  OHNE JEDE GEWÄHRLEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewährleistung der MARKTFÄHIGKEIT oder EIGNUNG FÜR EINEN BESTIMMTEN ZWECK.
+ *  Siehe die GNU General Public License für weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <https://www.gnu.org/licenses/>.
+ ******************************************************************************
+ * Bisher war die gesamte Mathematik fest auf AVX2/FMA gebaut und mit MSVC-Spezialitäten
+ * (m256d_f64, __forceinline, #pragma optimize) gespickt.  Ein Binary für alle Rechner geht so
+ * nicht.  Deshalb liegen die heißen Schleifen jetzt hier als Kernel-Sätze in mehreren Stufen vor:
+ *  -   Scalar: reines C++, läuft überall und ist die Referenz für alle anderen
+ *  -   SSE2:   x86-64 Grundausstattung, 2 doubles je Register
+ *  -   AVX2:   mit FMA, 4 doubles je Register (piesimd_avx2.cpp)
+ *  -   AVX512: AVX-512F, 8 doubles je Register (piesimd_avx512.cpp)
+ * Nur die Kernel-Funktionen selbst bekommen den Befehlssatz (PIE_SIMD_TARGET), die Auswahl
+ * passiert beim ersten Aufruf von PieSimd::kernels() anhand der CPU.
+ *****************************************************************************/
+#pragma once
+
+// Befehlssatz je Funktion: piesimd_avx2.cpp und piesimd_avx512.cpp werden ohne -mavx2/-mavx512f
+// übersetzt, nur die Kernels selbst tragen das Attribut.  Mit Flags für die ganze Datei würden
+// auch die Inline-Funktionen aus den Headern (operator[], qMax, minLane, ...) als AVX-Code
+// erzeugt - und der Linker darf genau diese Kopie für alle Aufrufer behalten.  MSVC kennt die
+// Intrinsics auch ohne /arch.
+#if defined( __GNUC__ ) || defined( __clang__ )
+#	define PIE_SIMD_TARGET( isa ) __attribute__( ( target( isa ) ) )
+#else
+#	define PIE_SIMD_TARGET( isa )
+#endif
+
+#include <QPointF>
+#include <QRect>
+#include <QRectF>
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <new>
+
+// Ein "__m256d" zum Anfassen: 4 doubles in genau der Reihenfolge, in der SPElem seine Animations-
+// werte ablegt (Radius, Winkel, Deckkraft, Skalierung).  Ohne compilerspezifische Member.
+struct alignas( 32 ) PieQuad
+{
+	qreal r{ 0. }, a{ 0. }, o{ 0. }, s{ 0.5 };
+
+	qreal		*data() { return &r; }
+	const qreal *data() const { return &r; }
+	qreal		&operator[]( int i ) { return data()[ i ]; }
+	qreal		 operator[]( int i ) const { return data()[ i ]; }
+};
+
+// SoA-Spiegel der SPElem-Liste: jede Größe bekommt ihr eigenes, 64-Byte-ausgerichtetes Array.
+// Die Länge wird auf ein Vielfaches der breitesten Vektorstufe (8 doubles bei AVX-512)
+// aufgerundet, damit jeder Kernel immer volle Register verarbeiten kann.  Füll-Elemente haben
+// Größe 0 und t0/t1 = 0/1.
+struct SPLanes
+{
+	enum Lane { W, H, T0, T1, QR, QA, QO, QS, ZR, ZA, ZO, ZS, CR, CA, CO, CS, LaneCount };
+	static constexpr int width = 8;
+	static constexpr int align = 64;
+
+	SPLanes() = default;
+	SPLanes( const SPLanes &o ) { *this = o; }
+	SPLanes &operator=( const SPLanes &o )
+	{
+		if ( this != &o )
+		{
+			resize( o.count );
+			if ( stride ) std::copy_n( o.buf.get(), LaneCount * stride, buf.get() );
+		}
+		return *this;
+	}
+	void		 resize( int n );
+	qreal		*operator[]( Lane l ) { return buf.get() + l * stride; }
+	const qreal *operator[]( Lane l ) const { return buf.get() + l * stride; }
+
+	int			 count{ 0 }, stride{ 0 };
+
+  private:
+	struct Free
+	{
+		void operator()( qreal *p ) const { ::operator delete[]( p, std::align_val_t{ align } ); }
+	};
+	std::unique_ptr< qreal[], Free > buf;
+	int								 capacity{ 0 };
+};
+
+// SoA-Spiegel der aktuellen Action-Rects für den Hit-Test: left/top/right/bottom als int32, dazu
+// zwei Skip-Lanes.  Deren Wert wird per max() auf den Abstand gerechnet - INT_MIN lässt ihn
+// unverändert, INT_MAX schließt das Element aus.  So braucht der Kernel keine Verzweigung und
+// niemand muss mehr QAction::isSeparator() fragen.
+//  -   SkipSep: Separatoren und Füll-Elemente (hitTest)
+//  -   SkipPad: nur Füll-Elemente (actionIndexAt)
+// Die Länge wird auf 16 (int32 je AVX-512-Register) aufgerundet.
+struct PieRectLanes
+{
+	enum Lane { L, T, R, B, SkipSep, SkipPad, LaneCount };
+	static constexpr int	width = 16;
+	static constexpr int	align = 64;
+	static constexpr qint32 keep = std::numeric_limits< qint32 >::min();
+	static constexpr qint32 skip = std::numeric_limits< qint32 >::max();
+
+	// Alle Elemente: leeres Rect, nicht übersprungen - die Füll-Elemente immer übersprungen
+	void					resize( int n );
+	void					set( int i, const QRect &r )
+	{
+		( *this )[ L ][ i ] = r.left(), ( *this )[ T ][ i ] = r.top();
+		( *this )[ R ][ i ] = r.right(), ( *this )[ B ][ i ] = r.bottom();
+	}
+	void		  setSeparator( int i, bool sep ) { ( *this )[ SkipSep ][ i ] = sep ? skip : keep; }
+	qint32		 *operator[]( Lane l ) { return buf.get() + l * stride; }
+	const qint32 *operator[]( Lane l ) const { return buf.get() + l * stride; }
+
+	int			  count{ 0 }, stride{ 0 };
+
+  private:
+	struct Free
+	{
+		void operator()( qint32 *p ) const { ::operator delete[]( p, std::align_val_t{ align } ); }
+	};
+	std::unique_ptr< qint32[], Free > buf;
+	int								  capacity{ 0 };
+};
+
+// SoA-Spiegel einer QRectF-Liste für die Überlappungssuche des SimdIntersector: die normalisierten
+// Kanten als doubles.  Anders als die anderen Lanes wächst diese Liste Element für Element, deshalb
+// ist stride hier die Kapazität je Lane (Vielfaches von 8 = doubles je AVX-512-Register).  Leere
+// Rects und alle Plätze ab count stehen als "umgestülptes" Rect (L/T = max, R/B = lowest) drin -
+// damit überlappen sie nie, auch nicht im letzten, nur halb gefüllten Register.
+struct PieRectFLanes
+{
+	enum Lane { L, T, R, B, LaneCount };
+	static constexpr int   width = 8;
+	static constexpr int   align = 64;
+	static constexpr qreal leer	 = std::numeric_limits< qreal >::max();
+
+	// Vorhandene Elemente bleiben erhalten, alles ab n wird leer
+	void				   resize( int n );
+	void				   clear() { resize( 0 ); }
+	void				   append( const QRectF &r ) { resize( count + 1 ), set( count - 1, r ); }
+	void				   set( int i, const QRectF &r )
+	{
+		const auto n	 = r.normalized();
+		const bool voll = n.width() > 0. && n.height() > 0.;
+		( *this )[ L ][ i ] = voll ? n.left() : leer, ( *this )[ T ][ i ] = voll ? n.top() : leer;
+		( *this )[ R ][ i ] = voll ? n.right() : -leer;
+		( *this )[ B ][ i ] = voll ? n.bottom() : -leer;
+	}
+	qreal		*operator[]( Lane l ) { return buf.get() + l * stride; }
+	const qreal *operator[]( Lane l ) const { return buf.get() + l * stride; }
+
+	int			 count{ 0 }, stride{ 0 };
+
+  private:
+	struct Free
+	{
+		void operator()( qreal *p ) const { ::operator delete[]( p, std::align_val_t{ align } ); }
+	};
+	std::unique_ptr< qreal[], Free > buf;
+};
+
+namespace PieSimd
+{
+	enum class Level { Scalar, SSE2, AVX2, AVX512 };
+
+	struct Kernels
+	{
+		Level		level;
+		const char *name;
+		// SuperPolator::update(): Smoothstep, Lerp (Ergebnis zurück in die CR..CS-Lanes) und
+		// Polar->Kartesisch inklusive QRect::setSize()/moveCenter()-Rundung für alle Elemente.
+		void ( *interpolate )( SPLanes &lanes, qreal t, QRect *rects, QPointF *opaScale );
+		// out = a + t * ( b - a ) für 4 doubles (QRectF, PieQuad, ...)
+		void ( *lerp4 )( qreal t, const qreal *a, const qreal *b, qreal *out );
+		// Lerp zweier QRgba64 (4 x 16 Bit), t wird auf [0..1] geklammert
+		quint64 ( *lerpRgba64 )( quint64 a, quint64 b, qreal t );
+		// Hit-Test: kleinster Box-Abstand (Signed Distance wie QPieMenu::boxDistance) von p zu
+		// allen nicht übersprungenen Rects.  Gibt den Index zurück (bei Gleichstand den kleinsten,
+		// -1 wenn alle übersprungen wurden), der Abstand landet in *dist.
+		int ( *minBoxDistance )( const PieRectLanes &r, PieRectLanes::Lane skip, QPoint p,
+								 int *dist );
+		// Überlappung wie QRectF::intersects() - c sind die Kanten l, t, r, b eines normalisierten,
+		// nicht leeren Rects.  Liefert den kleinsten Index bzw. den größten Index unterhalb von
+		// bis, dessen Rect c überlappt, sonst -1.
+		int ( *firstOverlap )( const PieRectFLanes &r, const qreal *c );
+		int ( *lastOverlap )( const PieRectFLanes &r, const qreal *c, int bis );
+	};
+
+	// Letzter Schritt der Vektor-Kernels: Minimum über die Register-Lanes, bei Gleichstand gewinnt
+	// der kleinere Index.
+	inline int minLane( const qint32 *d, const qint32 *idx, int n, int *dist )
+	{
+		int md = PieRectLanes::skip, id = -1;
+		for ( int k = 0; k < n; ++k )
+			if ( d[ k ] < md || ( d[ k ] == md && idx[ k ] < id ) ) md = d[ k ], id = idx[ k ];
+		*dist = md;
+		return md == PieRectLanes::skip ? -1 : id;
+	}
+
+	// Der ausgewählte Kernel-Satz: die beste Stufe, die CPU und Build hergeben.  Zum Vergleichen
+	// lässt sich die Stufe mit der Umgebungsvariable PIEMENU_SIMD=scalar|sse2|avx2|avx512 nach
+	// unten begrenzen.
+	const Kernels &kernels();
+	// Ein bestimmter Kernel-Satz - nullptr, wenn er nicht gebaut wurde oder die CPU ihn nicht kann.
+	const Kernels *kernels( Level l );
+	// Die höchste Stufe, die diese CPU mit diesem Build ausführen kann.
+	Level		   supported();
+	const char	  *levelName( Level l );
+} // namespace PieSimd
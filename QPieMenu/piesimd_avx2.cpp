@@ -0,0 +1,242 @@
+/******************************************************************************
+ * piesimd_avx2.cpp - AVX2/FMA-Kernels, 4 doubles je Register
+ * ===========================================================
+ * Author: Stefan <St0fF / the0bsessedManiacs> Kaps
+ ******************************************************************************
+ *  Diese Datei ist Teil von PieMenuTesting.
+ *
+ *  PieMenuTesting ist Freie Software: Sie können es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Wahl) jeder neueren
+ *  veröffentlichten Version, weiter verteilen und/oder modifizieren.
+ *
+ *  PieMenuTesting wird in der Hoffnung, dass es nützlich sein wird, aber
+ *  OHNE JEDE GEWÄHRLEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewährleistung der MARKTFÄHIGKEIT oder EIGNUNG FÜR EINEN BESTIMMTEN ZWECK.
+ *  Siehe die GNU General Public License für weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <https://www.gnu.org/licenses/>.
+ ******************************************************************************
+ * Die Datei selbst wird ohne -mavx2 übersetzt, nur die Funktionen hier tragen PIE_AVX2.  Alles,
+ * was daraus aufgerufen wird (Header-Inlines, Lambdas), bleibt damit Code für jede CPU - deshalb
+ * stehen die Ladebefehle auch nicht in Lambdas, die das Attribut nicht erben würden.
+ *****************************************************************************/
+#include "piesimd.h"
+
+#include <bit>
+#include <immintrin.h>
+
+#define PIE_AVX2 PIE_SIMD_TARGET( "avx2,fma" )
+
+// sin und cos für 4 Winkel gleichzeitig.  Reduktion auf [-pi/4, pi/4] nach Cody-Waite, danach die
+// Cephes-Polynome.  Für die Winkel, die hier vorkommen (einige wenige Umdrehungen), ist der Fehler
+// im Bereich von 1 ULP - mehr als genug für Pixel-Koordinaten.
+PIE_AVX2 static inline void sinCos4( __m256d x, __m256d &s, __m256d &c )
+{
+	const auto q = _mm256_round_pd( _mm256_mul_pd( x, _mm256_set1_pd( M_2_PI ) ),
+									_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+	auto	   r = _mm256_fnmadd_pd( q, _mm256_set1_pd( 1.57079632673412561417e+00 ), x );
+	r			 = _mm256_fnmadd_pd( q, _mm256_set1_pd( 6.07710050630396597660e-11 ), r );
+	r			 = _mm256_fnmadd_pd( q, _mm256_set1_pd( 2.02226624879595063154e-21 ), r );
+	const auto z = _mm256_mul_pd( r, r );
+	auto	   ps = _mm256_set1_pd( 1.58962301576546568060e-10 );
+	ps			  = _mm256_fmadd_pd( ps, z, _mm256_set1_pd( -2.50507477628578072866e-8 ) );
+	ps			  = _mm256_fmadd_pd( ps, z, _mm256_set1_pd( 2.75573136213857245213e-6 ) );
+	ps			  = _mm256_fmadd_pd( ps, z, _mm256_set1_pd( -1.98412698295895385996e-4 ) );
+	ps			  = _mm256_fmadd_pd( ps, z, _mm256_set1_pd( 8.33333333332211858878e-3 ) );
+	ps			  = _mm256_fmadd_pd( ps, z, _mm256_set1_pd( -1.66666666666666307295e-1 ) );
+	ps			  = _mm256_fmadd_pd( _mm256_mul_pd( ps, z ), r, r );
+	auto pc		  = _mm256_set1_pd( -1.13585365213876817300e-11 );
+	pc			  = _mm256_fmadd_pd( pc, z, _mm256_set1_pd( 2.08757008419747316778e-9 ) );
+	pc			  = _mm256_fmadd_pd( pc, z, _mm256_set1_pd( -2.75573141792967388112e-7 ) );
+	pc			  = _mm256_fmadd_pd( pc, z, _mm256_set1_pd( 2.48015872888517045348e-5 ) );
+	pc			  = _mm256_fmadd_pd( pc, z, _mm256_set1_pd( -1.38888888888730564116e-3 ) );
+	pc			  = _mm256_fmadd_pd( pc, z, _mm256_set1_pd( 4.16666666666665929218e-2 ) );
+	const auto h  = _mm256_fnmadd_pd( _mm256_set1_pd( 0.5 ), z, _mm256_set1_pd( 1. ) );
+	pc			  = _mm256_fmadd_pd( _mm256_mul_pd( pc, z ), z, h );
+	// Quadrant: das Zweierkomplement liefert q mod 4 direkt in den unteren Bits.
+	//  Bit 0 -> sin/cos tauschen, Bit 1 -> sin negieren, Bit 1 von (q+1) -> cos negieren
+	const auto qi  = _mm256_cvtepi32_epi64( _mm256_cvtpd_epi32( q ) );
+	const auto two = _mm256_set1_epi64x( 2 );
+	const auto swp = _mm256_castsi256_pd( _mm256_slli_epi64( qi, 63 ) );
+	const auto ngs = _mm256_castsi256_pd( _mm256_slli_epi64( _mm256_and_si256( qi, two ), 62 ) );
+	const auto ngc = _mm256_castsi256_pd( _mm256_slli_epi64(
+		_mm256_and_si256( _mm256_add_epi64( qi, _mm256_set1_epi64x( 1 ) ), two ), 62 ) );
+	s			   = _mm256_xor_pd( _mm256_blendv_pd( ps, pc, swp ), ngs );
+	c			   = _mm256_xor_pd( _mm256_blendv_pd( pc, ps, swp ), ngc );
+}
+// qRound() für 4 doubles -> 4 ints, halb weg von 0 wie in round2()
+PIE_AVX2 static inline __m128i round4( __m256d v )
+{
+	const auto h = _mm256_or_pd( _mm256_set1_pd( 0.5 ), _mm256_and_pd( v, _mm256_set1_pd( -0. ) ) );
+	return _mm256_cvttpd_epi32( _mm256_add_pd( v, h ) );
+}
+// Ganzzahl-Division durch 2 mit Rundung gegen 0 (wie "w / 2" in QRect::moveCenter)
+PIE_AVX2 static inline __m128i half4( __m128i v )
+{
+	return _mm_srai_epi32( _mm_add_epi32( v, _mm_srli_epi32( v, 31 ) ), 1 );
+}
+
+PIE_AVX2 static void interpolateAVX2( SPLanes &l, qreal t, QRect *rects, QPointF *opaScale )
+{
+	const auto _t = _mm256_set1_pd( t ), n0 = _mm256_setzero_pd(), n1 = _mm256_set1_pd( 1. );
+	const auto n2 = _mm256_set1_pd( 2. ), n3 = _mm256_set1_pd( 3. );
+	const auto i1 = _mm_set1_epi32( 1 );
+	for ( int i = 0, cnt = l.count; i < cnt; i += 4 )
+	{
+		// x(t) Super-Smoothstep für 4 Elemente auf einmal ...
+		auto t0	 = _mm256_load_pd( l[ SPLanes::T0 ] + i );
+		auto t1	 = _mm256_load_pd( l[ SPLanes::T1 ] + i );
+		auto x	 = _mm256_div_pd( _mm256_sub_pd( _t, t0 ), _mm256_sub_pd( t1, t0 ) );
+		x		 = _mm256_max_pd( n0, _mm256_min_pd( n1, x ) );
+		auto sst = _mm256_mul_pd( _mm256_mul_pd( x, x ), _mm256_fnmadd_pd( n2, x, n3 ) );
+
+		// Interpolation von r, a, o und s
+		__m256d cv[ 4 ];
+		for ( int k = 0; k < 4; ++k )
+		{
+			auto q	= _mm256_load_pd( l[ SPLanes::Lane( SPLanes::QR + k ) ] + i );
+			auto z	= _mm256_load_pd( l[ SPLanes::Lane( SPLanes::ZR + k ) ] + i );
+			cv[ k ] = _mm256_fmadd_pd( z, sst, _mm256_fnmadd_pd( q, sst, q ) );
+			_mm256_store_pd( l[ SPLanes::Lane( SPLanes::CR + k ) ] + i, cv[ k ] );
+		}
+
+		// Boxen berechnen - das Gleiche wie QRect::setSize() gefolgt von QRect::moveCenter()
+		__m256d sn, cs;
+		sinCos4( cv[ 1 ], sn, cs );
+		auto cx = round4( _mm256_mul_pd( cv[ 0 ], sn ) );
+		auto cy = round4( _mm256_mul_pd( cv[ 0 ], cs ) );
+		auto w1 = _mm_sub_epi32(
+			round4( _mm256_mul_pd( cv[ 3 ], _mm256_load_pd( l[ SPLanes::W ] + i ) ) ), i1 );
+		auto h1 = _mm_sub_epi32(
+			round4( _mm256_mul_pd( cv[ 3 ], _mm256_load_pd( l[ SPLanes::H ] + i ) ) ), i1 );
+		auto x1 = _mm_sub_epi32( cx, half4( w1 ) ), y1 = _mm_sub_epi32( cy, half4( h1 ) );
+		auto x2 = _mm_add_epi32( x1, w1 ), y2 = _mm_add_epi32( y1, h1 );
+		// 4x4 transponieren -> je Element x1, y1, x2, y2 (so liegt QRect intern im Speicher)
+		auto	a0 = _mm_unpacklo_epi32( x1, y1 ), a1 = _mm_unpackhi_epi32( x1, y1 );
+		auto	b0 = _mm_unpacklo_epi32( x2, y2 ), b1 = _mm_unpackhi_epi32( x2, y2 );
+		__m128i rc[ 4 ] = { _mm_unpacklo_epi64( a0, b0 ), _mm_unpackhi_epi64( a0, b0 ),
+							_mm_unpacklo_epi64( a1, b1 ), _mm_unpackhi_epi64( a1, b1 ) };
+		// Opacity und Scale paarweise verschränken -> QPointF{ o, s }
+		auto lo	  = _mm256_unpacklo_pd( cv[ 2 ], cv[ 3 ] );
+		auto hi	  = _mm256_unpackhi_pd( cv[ 2 ], cv[ 3 ] );
+		auto os01 = _mm256_permute2f128_pd( lo, hi, 0x20 );
+		auto os23 = _mm256_permute2f128_pd( lo, hi, 0x31 );
+		if ( Q_LIKELY( cnt - i >= 4 ) )
+		{
+			for ( int k = 0; k < 4; ++k )
+				_mm_storeu_si128( reinterpret_cast< __m128i * >( rects + i + k ), rc[ k ] );
+			_mm256_storeu_pd( reinterpret_cast< qreal * >( opaScale + i ), os01 );
+			_mm256_storeu_pd( reinterpret_cast< qreal * >( opaScale + i + 2 ), os23 );
+		} else {
+			// Rest: nur die gültigen Elemente schreiben
+			alignas( 32 ) QPointF os[ 4 ];
+			_mm256_store_pd( reinterpret_cast< qreal * >( os ), os01 );
+			_mm256_store_pd( reinterpret_cast< qreal * >( os + 2 ), os23 );
+			for ( int k = 0; k < cnt - i; ++k )
+			{
+				_mm_storeu_si128( reinterpret_cast< __m128i * >( rects + i + k ), rc[ k ] );
+				opaScale[ i + k ] = os[ k ];
+			}
+		}
+	}
+}
+
+PIE_AVX2 static void lerp4AVX2( qreal t, const qreal *a, const qreal *b, qreal *out )
+{
+	// fma( b, t, fnma( a, t, a ) ) - siehe PieSelectionRect::operator()
+	const auto _t = _mm256_set1_pd( t );
+	const auto a0 = _mm256_loadu_pd( a );
+	_mm256_storeu_pd( out,
+					  _mm256_fmadd_pd( _mm256_loadu_pd( b ), _t, _mm256_fnmadd_pd( a0, _t, a0 ) ) );
+}
+
+PIE_AVX2 static quint64 lerpRgba64AVX2( quint64 a, quint64 b, qreal t )
+{
+	const auto _t = _mm256_set1_pd( t < 0. ? 0. : t > 1. ? 1. : t );
+	// über den Speicher statt _mm_cvtsi64_si128, das gibt es nur auf x86-64
+	auto pa = reinterpret_cast< const __m128i * >( &a );
+	auto pb = reinterpret_cast< const __m128i * >( &b );
+	auto c0 = _mm256_cvtepi32_pd( _mm_cvtepu16_epi32( _mm_loadl_epi64( pa ) ) );
+	auto c1 = _mm256_cvtepi32_pd( _mm_cvtepu16_epi32( _mm_loadl_epi64( pb ) ) );
+	auto r	= _mm256_cvtpd_epi32( _mm256_fmadd_pd( c1, _t, _mm256_fnmadd_pd( c0, _t, c0 ) ) );
+	quint64 res;
+	_mm_storel_epi64( reinterpret_cast< __m128i * >( &res ), _mm_packus_epi32( r, r ) );
+	return res;
+}
+
+// Lambdas erben das Zielattribut nicht, daher als eigene Funktion
+PIE_AVX2 static inline __m256i ld8( const qint32 *p )
+{
+	return _mm256_load_si256( reinterpret_cast< const __m256i * >( p ) );
+}
+
+PIE_AVX2 static int minBoxDistanceAVX2( const PieRectLanes &r, PieRectLanes::Lane skip,
+										QPoint p, int *dist )
+{
+	// 8 Boxen je Durchlauf
+	const auto px = _mm256_set1_epi32( p.x() ), py = _mm256_set1_epi32( p.y() );
+	const auto acht = _mm256_set1_epi32( 8 );
+	auto	   best = _mm256_set1_epi32( PieRectLanes::skip ), bestI = _mm256_set1_epi32( -1 );
+	auto	   idx	= _mm256_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7 );
+	const qint32 *L = r[ PieRectLanes::L ], *R = r[ PieRectLanes::R ], *T = r[ PieRectLanes::T ],
+				 *B = r[ PieRectLanes::B ], *S = r[ skip ];
+	for ( int i = 0; i < r.stride; i += 8, idx = _mm256_add_epi32( idx, acht ) )
+	{
+		auto dx = _mm256_max_epi32( _mm256_sub_epi32( ld8( L + i ), px ),
+									_mm256_sub_epi32( px, ld8( R + i ) ) );
+		auto dy = _mm256_max_epi32( _mm256_sub_epi32( ld8( T + i ), py ),
+									_mm256_sub_epi32( py, ld8( B + i ) ) );
+		auto d	= _mm256_max_epi32( _mm256_max_epi32( dx, dy ), ld8( S + i ) );
+		// nur echt kleiner übernehmen -> je Lane bleibt der kleinste Index stehen
+		auto m = _mm256_cmpgt_epi32( best, d );
+		best   = _mm256_blendv_epi8( best, d, m );
+		bestI  = _mm256_blendv_epi8( bestI, idx, m );
+	}
+	alignas( 32 ) qint32 bd[ 8 ], bi[ 8 ];
+	_mm256_store_si256( reinterpret_cast< __m256i * >( bd ), best );
+	_mm256_store_si256( reinterpret_cast< __m256i * >( bi ), bestI );
+	return PieSimd::minLane( bd, bi, 8, dist );
+}
+
+// 4 Rects je Vergleich, Bit k gesetzt: das Rect in Lane i + k überlappt c
+PIE_AVX2 static inline unsigned overlap4( const PieRectFLanes &r, const __m256d *c, int i )
+{
+	const qreal *L = r[ PieRectFLanes::L ] + i, *T = r[ PieRectFLanes::T ] + i,
+				*R = r[ PieRectFLanes::R ] + i, *B = r[ PieRectFLanes::B ] + i;
+	auto m = _mm256_and_pd( _mm256_cmp_pd( c[ 0 ], _mm256_load_pd( R ), _CMP_LT_OQ ),
+							_mm256_cmp_pd( _mm256_load_pd( L ), c[ 2 ], _CMP_LT_OQ ) );
+	m	   = _mm256_and_pd( m, _mm256_cmp_pd( c[ 1 ], _mm256_load_pd( B ), _CMP_LT_OQ ) );
+	m	   = _mm256_and_pd( m, _mm256_cmp_pd( _mm256_load_pd( T ), c[ 3 ], _CMP_LT_OQ ) );
+	return unsigned( _mm256_movemask_pd( m ) );
+}
+
+PIE_AVX2 static int firstOverlapAVX2( const PieRectFLanes &r, const qreal *c )
+{
+	const __m256d cc[ 4 ] = { _mm256_set1_pd( c[ 0 ] ), _mm256_set1_pd( c[ 1 ] ),
+							  _mm256_set1_pd( c[ 2 ] ), _mm256_set1_pd( c[ 3 ] ) };
+	for ( int i = 0; i < r.count; i += 4 )
+		if ( auto m = overlap4( r, cc, i ) ) return i + std::countr_zero( m );
+	return -1;
+}
+
+PIE_AVX2 static int lastOverlapAVX2( const PieRectFLanes &r, const qreal *c, int bis )
+{
+	const __m256d cc[ 4 ] = { _mm256_set1_pd( c[ 0 ] ), _mm256_set1_pd( c[ 1 ] ),
+							  _mm256_set1_pd( c[ 2 ] ), _mm256_set1_pd( c[ 3 ] ) };
+	for ( int i = ( bis - 1 ) & ~3; i >= 0; i -= 4 )
+	{
+		// nur im ersten Register können Lanes ab bis liegen
+		const unsigned gueltig = bis - i >= 4 ? 0xfu : ( 1u << ( bis - i ) ) - 1;
+		if ( auto m = overlap4( r, cc, i ) & gueltig ) return i + std::bit_width( m ) - 1;
+	}
+	return -1;
+}
+
+namespace PieSimd
+{
+	extern const Kernels avx2Kernels{ Level::AVX2, "avx2", interpolateAVX2, lerp4AVX2,
+									  lerpRgba64AVX2, minBoxDistanceAVX2, firstOverlapAVX2,
+									  lastOverlapAVX2 };
+} // namespace PieSimd
@@ -0,0 +1,242 @@
+/******************************************************************************
+ * piesimd_avx512.cpp - AVX-512F-Kernels, 8 doubles je Register
+ * =============================================================
+ * Author: Stefan <St0fF / the0bsessedManiacs> Kaps
+ ******************************************************************************
+ *  Diese Datei ist Teil von PieMenuTesting.
+ *
+ *  PieMenuTesting ist Freie Software: Sie können es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Wahl) jeder neueren
+ *  veröffentlichten Version, weiter verteilen und/oder modifizieren.
+ *
+ *  PieMenuTesting wird in der Hoffnung, dass es nützlich sein wird, aber
+ *  OHNE JEDE GEWÄHRLEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewährleistung der MARKTFÄHIGKEIT oder EIGNUNG FÜR EINEN BESTIMMTEN ZWECK.
+ *  Siehe die GNU General Public License für weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <https://www.gnu.org/licenses/>.
+ ******************************************************************************
+ * Wie piesimd_avx2.cpp, nur doppelt so breit.  Verwendet wird ausschließlich AVX-512F (plus die
+ * AVX2-Befehle, die jede AVX-512-CPU ohnehin hat), damit auch die ersten Xeon-Phi-artigen Kerne
+ * ohne DQ/VL mitspielen.
+ *****************************************************************************/
+#include "piesimd.h"
+
+#include <bit>
+#include <immintrin.h>
+
+#define PIE_AVX512 PIE_SIMD_TARGET( "avx512f,avx2,fma" )
+
+PIE_AVX512 static inline __m512d set8( qreal v )
+{
+	return _mm512_set1_pd( v );
+}
+
+// sin und cos für 8 Winkel - gleiche Reduktion und Polynome wie sinCos4()
+PIE_AVX512 static inline void sinCos8( __m512d x, __m512d &s, __m512d &c )
+{
+	const auto q = _mm512_roundscale_pd( _mm512_mul_pd( x, set8( M_2_PI ) ),
+										 _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+	auto	   r = _mm512_fnmadd_pd( q, set8( 1.57079632673412561417e+00 ), x );
+	r			 = _mm512_fnmadd_pd( q, set8( 6.07710050630396597660e-11 ), r );
+	r			 = _mm512_fnmadd_pd( q, set8( 2.02226624879595063154e-21 ), r );
+	const auto z = _mm512_mul_pd( r, r );
+	auto	   ps = set8( 1.58962301576546568060e-10 );
+	ps			  = _mm512_fmadd_pd( ps, z, set8( -2.50507477628578072866e-8 ) );
+	ps			  = _mm512_fmadd_pd( ps, z, set8( 2.75573136213857245213e-6 ) );
+	ps			  = _mm512_fmadd_pd( ps, z, set8( -1.98412698295895385996e-4 ) );
+	ps			  = _mm512_fmadd_pd( ps, z, set8( 8.33333333332211858878e-3 ) );
+	ps			  = _mm512_fmadd_pd( ps, z, set8( -1.66666666666666307295e-1 ) );
+	ps			  = _mm512_fmadd_pd( _mm512_mul_pd( ps, z ), r, r );
+	auto pc		  = set8( -1.13585365213876817300e-11 );
+	pc			  = _mm512_fmadd_pd( pc, z, set8( 2.08757008419747316778e-9 ) );
+	pc			  = _mm512_fmadd_pd( pc, z, set8( -2.75573141792967388112e-7 ) );
+	pc			  = _mm512_fmadd_pd( pc, z, set8( 2.48015872888517045348e-5 ) );
+	pc			  = _mm512_fmadd_pd( pc, z, set8( -1.38888888888730564116e-3 ) );
+	pc			  = _mm512_fmadd_pd( pc, z, set8( 4.16666666666665929218e-2 ) );
+	pc			  = _mm512_fmadd_pd( _mm512_mul_pd( pc, z ), z,
+									 _mm512_fnmadd_pd( set8( 0.5 ), z, set8( 1. ) ) );
+	// Quadrant: Tauschen über eine Maske, die Vorzeichen per xor auf den Ganzzahl-Registern
+	// (xor_pd wäre erst AVX512DQ)
+	const auto qi  = _mm512_cvtepi32_epi64( _mm512_cvtpd_epi32( q ) );
+	const auto one = _mm512_set1_epi64( 1 ), two = _mm512_set1_epi64( 2 );
+	const auto swp = _mm512_test_epi64_mask( qi, one );
+	const auto ngs = _mm512_slli_epi64( _mm512_and_si512( qi, two ), 62 );
+	const auto ngc = _mm512_slli_epi64( _mm512_and_si512( _mm512_add_epi64( qi, one ), two ), 62 );
+	s = _mm512_castsi512_pd(
+		_mm512_xor_si512( _mm512_castpd_si512( _mm512_mask_blend_pd( swp, ps, pc ) ), ngs ) );
+	c = _mm512_castsi512_pd(
+		_mm512_xor_si512( _mm512_castpd_si512( _mm512_mask_blend_pd( swp, pc, ps ) ), ngc ) );
+}
+// qRound() für 8 doubles -> 8 ints, halb weg von 0.  Ohne AVX-512DQ gibt es kein and/or auf
+// doubles, also wählt die Maske zwischen v + 0.5 und v - 0.5.
+PIE_AVX512 static inline __m256i round8( __m512d v )
+{
+	const auto h   = set8( 0.5 );
+	const auto neg = _mm512_cmp_pd_mask( v, _mm512_setzero_pd(), _CMP_LT_OQ );
+	return _mm512_cvttpd_epi32( _mm512_mask_sub_pd( _mm512_add_pd( v, h ), neg, v, h ) );
+}
+// Ganzzahl-Division durch 2 mit Rundung gegen 0 (wie "w / 2" in QRect::moveCenter)
+PIE_AVX512 static inline __m256i half8( __m256i v )
+{
+	return _mm256_srai_epi32( _mm256_add_epi32( v, _mm256_srli_epi32( v, 31 ) ), 1 );
+}
+
+PIE_AVX512 static void interpolateAVX512( SPLanes &l, qreal t, QRect *rects, QPointF *opaScale )
+{
+	const auto _t = set8( t ), n0 = _mm512_setzero_pd(), n1 = set8( 1. );
+	const auto i1 = _mm256_set1_epi32( 1 );
+	// Verschränkung per permutex2var: Index 0..7 = Opacity, 8..15 = Scale
+	const auto p0 = _mm512_setr_epi64( 0, 8, 1, 9, 2, 10, 3, 11 );
+	const auto p1 = _mm512_setr_epi64( 4, 12, 5, 13, 6, 14, 7, 15 );
+	for ( int i = 0, cnt = l.count; i < cnt; i += 8 )
+	{
+		auto t0	 = _mm512_load_pd( l[ SPLanes::T0 ] + i );
+		auto t1	 = _mm512_load_pd( l[ SPLanes::T1 ] + i );
+		auto x	 = _mm512_div_pd( _mm512_sub_pd( _t, t0 ), _mm512_sub_pd( t1, t0 ) );
+		x		 = _mm512_max_pd( n0, _mm512_min_pd( n1, x ) );
+		auto sst = _mm512_mul_pd( _mm512_mul_pd( x, x ),
+								  _mm512_fnmadd_pd( set8( 2. ), x, set8( 3. ) ) );
+
+		__m512d cv[ 4 ];
+		for ( int k = 0; k < 4; ++k )
+		{
+			auto q	= _mm512_load_pd( l[ SPLanes::Lane( SPLanes::QR + k ) ] + i );
+			auto z	= _mm512_load_pd( l[ SPLanes::Lane( SPLanes::ZR + k ) ] + i );
+			cv[ k ] = _mm512_fmadd_pd( z, sst, _mm512_fnmadd_pd( q, sst, q ) );
+			_mm512_store_pd( l[ SPLanes::Lane( SPLanes::CR + k ) ] + i, cv[ k ] );
+		}
+
+		__m512d sn, cs;
+		sinCos8( cv[ 1 ], sn, cs );
+		auto cx = round8( _mm512_mul_pd( cv[ 0 ], sn ) );
+		auto cy = round8( _mm512_mul_pd( cv[ 0 ], cs ) );
+		auto w1 = _mm256_sub_epi32(
+			round8( _mm512_mul_pd( cv[ 3 ], _mm512_load_pd( l[ SPLanes::W ] + i ) ) ), i1 );
+		auto h1 = _mm256_sub_epi32(
+			round8( _mm512_mul_pd( cv[ 3 ], _mm512_load_pd( l[ SPLanes::H ] + i ) ) ), i1 );
+		auto x1 = _mm256_sub_epi32( cx, half8( w1 ) ), y1 = _mm256_sub_epi32( cy, half8( h1 ) );
+		auto x2 = _mm256_add_epi32( x1, w1 ), y2 = _mm256_add_epi32( y1, h1 );
+		// Transponieren je 128-Bit-Hälfte: die untere liefert die Rects 0..3, die obere 4..7
+		auto	a0 = _mm256_unpacklo_epi32( x1, y1 ), a1 = _mm256_unpackhi_epi32( x1, y1 );
+		auto	b0 = _mm256_unpacklo_epi32( x2, y2 ), b1 = _mm256_unpackhi_epi32( x2, y2 );
+		__m256i rc[ 4 ] = { _mm256_unpacklo_epi64( a0, b0 ), _mm256_unpackhi_epi64( a0, b0 ),
+							_mm256_unpacklo_epi64( a1, b1 ), _mm256_unpackhi_epi64( a1, b1 ) };
+		alignas( 64 ) QRect rr[ 8 ];
+		for ( int k = 0; k < 4; ++k )
+		{
+			_mm_store_si128( reinterpret_cast< __m128i * >( rr + k ),
+							 _mm256_castsi256_si128( rc[ k ] ) );
+			_mm_store_si128( reinterpret_cast< __m128i * >( rr + k + 4 ),
+							 _mm256_extracti128_si256( rc[ k ], 1 ) );
+		}
+		// Opacity und Scale verschränken -> QPointF{ o, s }
+		auto os03 = _mm512_permutex2var_pd( cv[ 2 ], p0, cv[ 3 ] );
+		auto os47 = _mm512_permutex2var_pd( cv[ 2 ], p1, cv[ 3 ] );
+		if ( Q_LIKELY( cnt - i >= 8 ) )
+		{
+			for ( int k = 0; k < 8; ++k ) rects[ i + k ] = rr[ k ];
+			_mm512_storeu_pd( reinterpret_cast< qreal * >( opaScale + i ), os03 );
+			_mm512_storeu_pd( reinterpret_cast< qreal * >( opaScale + i + 4 ), os47 );
+		} else {
+			alignas( 64 ) QPointF os[ 8 ];
+			_mm512_store_pd( reinterpret_cast< qreal * >( os ), os03 );
+			_mm512_store_pd( reinterpret_cast< qreal * >( os + 4 ), os47 );
+			for ( int k = 0; k < cnt - i; ++k )
+				rects[ i + k ] = rr[ k ], opaScale[ i + k ] = os[ k ];
+		}
+	}
+}
+
+PIE_AVX512 static void lerp4AVX512( qreal t, const qreal *a, const qreal *b, qreal *out )
+{
+	// 4 doubles sind nur ein halbes Register - hier genügt die 256-Bit-Form
+	const auto _t = _mm256_set1_pd( t );
+	const auto a0 = _mm256_loadu_pd( a );
+	_mm256_storeu_pd( out,
+					  _mm256_fmadd_pd( _mm256_loadu_pd( b ), _t, _mm256_fnmadd_pd( a0, _t, a0 ) ) );
+}
+
+PIE_AVX512 static quint64 lerpRgba64AVX512( quint64 a, quint64 b, qreal t )
+{
+	const auto _t = _mm256_set1_pd( t < 0. ? 0. : t > 1. ? 1. : t );
+	// über den Speicher statt _mm_cvtsi64_si128, das gibt es nur auf x86-64
+	auto pa = reinterpret_cast< const __m128i * >( &a );
+	auto pb = reinterpret_cast< const __m128i * >( &b );
+	auto c0 = _mm256_cvtepi32_pd( _mm_cvtepu16_epi32( _mm_loadl_epi64( pa ) ) );
+	auto c1 = _mm256_cvtepi32_pd( _mm_cvtepu16_epi32( _mm_loadl_epi64( pb ) ) );
+	auto r	= _mm256_cvtpd_epi32( _mm256_fmadd_pd( c1, _t, _mm256_fnmadd_pd( c0, _t, c0 ) ) );
+	quint64 res;
+	_mm_storel_epi64( reinterpret_cast< __m128i * >( &res ), _mm_packus_epi32( r, r ) );
+	return res;
+}
+
+PIE_AVX512 static int minBoxDistanceAVX512( const PieRectLanes &r, PieRectLanes::Lane skip,
+											QPoint p, int *dist )
+{
+	// 16 Boxen je Durchlauf, Masken statt Blends
+	const auto px = _mm512_set1_epi32( p.x() ), py = _mm512_set1_epi32( p.y() );
+	const auto sechzehn = _mm512_set1_epi32( 16 );
+	auto	   best		= _mm512_set1_epi32( PieRectLanes::skip ), bestI = _mm512_set1_epi32( -1 );
+	auto idx = _mm512_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 );
+	const qint32 *L = r[ PieRectLanes::L ], *R = r[ PieRectLanes::R ], *T = r[ PieRectLanes::T ],
+				 *B = r[ PieRectLanes::B ], *S = r[ skip ];
+	for ( int i = 0; i < r.stride; i += 16, idx = _mm512_add_epi32( idx, sechzehn ) )
+	{
+		auto dx = _mm512_max_epi32( _mm512_sub_epi32( _mm512_load_si512( L + i ), px ),
+									_mm512_sub_epi32( px, _mm512_load_si512( R + i ) ) );
+		auto dy = _mm512_max_epi32( _mm512_sub_epi32( _mm512_load_si512( T + i ), py ),
+									_mm512_sub_epi32( py, _mm512_load_si512( B + i ) ) );
+		auto d	= _mm512_max_epi32( _mm512_max_epi32( dx, dy ), _mm512_load_si512( S + i ) );
+		// nur echt kleiner übernehmen -> je Lane bleibt der kleinste Index stehen
+		auto m = _mm512_cmplt_epi32_mask( d, best );
+		best   = _mm512_mask_blend_epi32( m, best, d );
+		bestI  = _mm512_mask_blend_epi32( m, bestI, idx );
+	}
+	int md = _mm512_reduce_min_epi32( best );
+	*dist  = md;
+	if ( md == PieRectLanes::skip ) return -1;
+	return _mm512_mask_reduce_min_epi32( _mm512_cmpeq_epi32_mask( best, _mm512_set1_epi32( md ) ),
+										 bestI );
+}
+
+// 8 Rects je Vergleich, die vier Tests verketten sich über die Maske
+PIE_AVX512 static inline unsigned overlap8( const PieRectFLanes &r, const __m512d *c, int i )
+{
+	const qreal *L = r[ PieRectFLanes::L ] + i, *T = r[ PieRectFLanes::T ] + i,
+				*R = r[ PieRectFLanes::R ] + i, *B = r[ PieRectFLanes::B ] + i;
+	auto m = _mm512_cmp_pd_mask( c[ 0 ], _mm512_load_pd( R ), _CMP_LT_OQ );
+	m	   = _mm512_mask_cmp_pd_mask( m, _mm512_load_pd( L ), c[ 2 ], _CMP_LT_OQ );
+	m	   = _mm512_mask_cmp_pd_mask( m, c[ 1 ], _mm512_load_pd( B ), _CMP_LT_OQ );
+	m	   = _mm512_mask_cmp_pd_mask( m, _mm512_load_pd( T ), c[ 3 ], _CMP_LT_OQ );
+	return unsigned( m );
+}
+
+PIE_AVX512 static int firstOverlapAVX512( const PieRectFLanes &r, const qreal *c )
+{
+	const __m512d cc[ 4 ] = { set8( c[ 0 ] ), set8( c[ 1 ] ), set8( c[ 2 ] ), set8( c[ 3 ] ) };
+	for ( int i = 0; i < r.count; i += 8 )
+		if ( auto m = overlap8( r, cc, i ) ) return i + std::countr_zero( m );
+	return -1;
+}
+
+PIE_AVX512 static int lastOverlapAVX512( const PieRectFLanes &r, const qreal *c, int bis )
+{
+	const __m512d cc[ 4 ] = { set8( c[ 0 ] ), set8( c[ 1 ] ), set8( c[ 2 ] ), set8( c[ 3 ] ) };
+	for ( int i = ( bis - 1 ) & ~7; i >= 0; i -= 8 )
+	{
+		// nur im ersten Register können Lanes ab bis liegen
+		const unsigned gueltig = bis - i >= 8 ? 0xffu : ( 1u << ( bis - i ) ) - 1;
+		if ( auto m = overlap8( r, cc, i ) & gueltig ) return i + std::bit_width( m ) - 1;
+	}
+	return -1;
+}
+
+namespace PieSimd
+{
+	extern const Kernels avx512Kernels{ Level::AVX512, "avx512", interpolateAVX512, lerp4AVX512,
+										lerpRgba64AVX512, minBoxDistanceAVX512, firstOverlapAVX512,
+										lastOverlapAVX512 };
+} // namespace PieSimd
@@ -0,0 +1,205 @@
+/******************************************************************************
+ * piestates.h - Ausführung der aus States.scxml erzeugten Zustandstabelle
+ * ============================================================
+ * Author: Stefan <St0fF / the0bsessedManiacs> Kaps
+ ******************************************************************************
+ *  Diese Datei ist Teil von PieMenuTesting.
+ *
+ *  PieMenuTesting ist Freie Software: Sie können es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Wahl) jeder neueren
+ *  veröffentlichten Version, weiter verteilen und/oder modifizieren.
+ *
+ *  PieMenuTesting wird in der Hoffnung, dass es nützlich sein wird, aber
+ *  OHNE JEDE GEWÄHRLEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewährleistung der MARKTFÄHIGKEIT oder EIGNUNG FÜR EINEN BESTIMMTEN ZWECK.
+ *  Siehe die GNU General Public License für weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <https://www.gnu.org/licenses/>.
+ ******************************************************************************
+ * PieStateTable.h wird beim Build von scxml2table aus diagrams/States.scxml erzeugt.  Hier steckt
+ * der Teil der SCXML-Semantik, den das Diagramm braucht:
+ *  -   Die Konfiguration ist eine Bitmaske aktiver Zustände (höchstens 32).
+ *  -   Je aktivem atomarem Zustand wird in Dokumentreihenfolge der erste passende Übergang
+ *      gesucht, bei ihm selbst beginnend bis hinauf zur Wurzel: suche[Zustand][Event] liefert den
+ *      Bereich, danach entscheidet nur noch die Bedingung.
+ *  -   Ein Übergang verlässt alle aktiven Zustände unterhalb seiner Domäne (in umgekehrter
+ *      Dokumentreihenfolge), führt seine Aktion aus und betritt das Ziel samt Start-Kindern.
+ *  -   <raise> landet in der internen Warteschlange, die nach jedem Event leer gearbeitet wird.
+ *  -   <send>/<cancel> und jeder Zustandswechsel gehen an den Hook.
+ * Der Hook H braucht:
+ *  -   void uebergang( State von, State nach, const Data &d )  - nach dem Betreten des Ziels
+ *  -   void senden( Event e, int ms ) und void abbrechen( Event e )
+ * Keine Allokation, kein QVariant - ein Event kostet ein paar Tabellenzugriffe.
+ *****************************************************************************/
+#pragma once
+
+#include "PieStateTable.h"
+
+#include <bit>
+#include <initializer_list>
+
+namespace PieStates
+{
+	using namespace PieStateTable;
+
+	constexpr quint32 bit( int s )
+	{
+		return 1u << s;
+	}
+	constexpr bool atomar( int s )
+	{
+		return start[ s ] < 0 && !parallel[ s ];
+	}
+	// s liegt (echt) unterhalb von a - a < 0 steht für das Dokument
+	constexpr bool unterhalb( int s, int a )
+	{
+		for ( s = eltern[ s ]; s >= 0; s = eltern[ s ] )
+			if ( s == a ) return true;
+		return a < 0;
+	}
+	// Nur diese Zustände suchen nach Übergängen - in Dokumentreihenfolge = aufsteigende Bits
+	constexpr quint32 atomarMaske = []
+	{
+		quint32 m = 0;
+		for ( int s = 0; s < StateCount; ++s )
+			if ( atomar( s ) ) m |= bit( s );
+		return m;
+	}();
+	// _event.data der internen Events
+	constexpr Data keineDaten{};
+
+	template < class H >
+	class Maschine
+	{
+	  public:
+		Maschine( Data &d, H &h ) : _d( d ), _h( h ) {}
+
+		// Vom Startzustand aus betreten (ohne Hook-Aufrufe für die Start-Kette)
+		void starten()
+		{
+			_aktiv = 0;
+			for ( int s = 0; s < StateCount; ++s )
+				if ( eltern[ s ] < 0 ) standard( s, keineDaten );
+		}
+		// Konfiguration direkt setzen: die genannten atomaren Zustände samt Vorfahren.  Aktionen
+		// laufen dabei keine - der Aufrufer kennt seinen Zustand schon.
+		void setzen( std::initializer_list< State > atomar )
+		{
+			_aktiv = 0;
+			for ( auto s : atomar )
+				for ( int a = s; a >= 0; a = eltern[ a ] ) _aktiv |= bit( a );
+		}
+		bool	 aktiv( State s ) const { return _aktiv & bit( s ); }
+		quint32	 konfiguration() const { return _aktiv; }
+
+		// Ein externes Event samt _event.data und danach alle dabei ausgelösten internen Events.
+		// Gibt die Anzahl der genommenen Übergänge mit Ziel zurück.
+		int		 ereignis( Event ev, const Data &e = keineDaten )
+		{
+			_uebergaenge = 0;
+			schritt( ev, e );
+			while ( _lesen < _schreiben ) schritt( _warte[ _lesen++ ], keineDaten );
+			_lesen = _schreiben = 0;
+			return _uebergaenge;
+		}
+
+		// Für die erzeugten Aktionen
+		void raise( Event ev )
+		{
+			Q_ASSERT( _schreiben < WarteMax );
+			if ( _schreiben < WarteMax ) _warte[ _schreiben++ ] = ev;
+		}
+		void senden( Event ev, int ms ) { _h.senden( ev, ms ); }
+		void abbrechen( Event ev ) { _h.abbrechen( ev ); }
+
+	  private:
+		static constexpr int WarteMax = 32;
+		Data				&_d;
+		H					&_h;
+		quint32				 _aktiv{ 0 };
+		Event				 _warte[ WarteMax ];
+		int					 _lesen{ 0 }, _schreiben{ 0 }, _uebergaenge{ 0 };
+
+		void schritt( Event ev, const Data &e )
+		{
+			// Auswahl: erst alle Übergänge bestimmen, dann ausführen (SCXML-Mikroschritt)
+			int gewaehlt[ StateCount ], n = 0;
+			for ( auto rest = _aktiv & atomarMaske; rest; rest &= rest - 1 )
+			{
+				const int s = std::countr_zero( rest );
+				int		  t = -1;
+				for ( int a = s; a >= 0 && t < 0; a = eltern[ a ] )
+				{
+					const auto &b = suche[ a ][ ev ];
+					for ( int i = b.erster; i < b.erster + b.anzahl; ++i )
+						if ( transitions[ i ].bedingung < 0
+							 || bedingung( transitions[ i ].bedingung, _d, e ) )
+						{
+							t = i;
+							break;
+						}
+				}
+				if ( t < 0 ) continue;
+				// Übergänge von Vorfahren (z.B. der parallelen Wurzel) nur einmal
+				bool doppelt = false;
+				for ( int k = 0; k < n; ++k ) doppelt |= gewaehlt[ k ] == t;
+				if ( !doppelt ) gewaehlt[ n++ ] = t;
+			}
+			for ( int k = 0; k < n; ++k ) ausfuehren( transitions[ gewaehlt[ k ] ], e );
+		}
+
+		void ausfuehren( const Transition &t, const Data &e )
+		{
+			if ( t.ziel < 0 )
+			{
+				if ( t.aktion >= 0 ) aktion( t.aktion, _d, e, *this );
+				return;
+			}
+			// Domäne: bei "internal" und einem Ziel unterhalb der Quelle die Quelle selbst, sonst
+			// der kleinste gemeinsame echte Vorfahr
+			int dom = t.quelle;
+			if ( !t.intern || atomar( t.quelle ) || !unterhalb( t.ziel, t.quelle ) )
+				for ( dom = eltern[ t.quelle ]; dom >= 0 && !unterhalb( t.ziel, dom ); )
+					dom = eltern[ dom ];
+			// Austritt in umgekehrter Dokumentreihenfolge: Kinder vor ihren Eltern
+			for ( int s = StateCount - 1; s >= 0; --s )
+				if ( ( _aktiv & bit( s ) ) && unterhalb( s, dom ) )
+				{
+					if ( austritt[ s ] >= 0 ) aktion( austritt[ s ], _d, e, *this );
+					_aktiv &= ~bit( s );
+				}
+			if ( t.aktion >= 0 ) aktion( t.aktion, _d, e, *this );
+			// Eintritt von der Domäne hinunter zum Ziel - parallele Geschwister mit ihrem Start
+			int kette[ StateCount ], n = 0;
+			for ( int s = t.ziel; s != dom; s = eltern[ s ] ) kette[ n++ ] = s;
+			while ( --n > 0 )
+			{
+				betreten( kette[ n ], e );
+				if ( parallel[ kette[ n ] ] )
+					for ( int c = 0; c < StateCount; ++c )
+						if ( eltern[ c ] == kette[ n ] && c != kette[ n - 1 ] ) standard( c, e );
+			}
+			standard( t.ziel, e );
+			++_uebergaenge;
+			_h.uebergang( t.quelle, State( t.ziel ), _d );
+		}
+
+		void betreten( int s, const Data &e )
+		{
+			if ( _aktiv & bit( s ) ) return;
+			_aktiv |= bit( s );
+			if ( eintritt[ s ] >= 0 ) aktion( eintritt[ s ], _d, e, *this );
+		}
+		void standard( int s, const Data &e )
+		{
+			betreten( s, e );
+			if ( parallel[ s ] )
+			{
+				for ( int c = 0; c < StateCount; ++c )
+					if ( eltern[ c ] == s ) standard( c, e );
+			} else if ( start[ s ] >= 0 ) standard( start[ s ], e );
+		}
+	};
+} // namespace PieStates
@@ -21,11 +21,19 @@
  *****************************************************************************/
 #include "qpiemenu.h"
 
+#include "piestates.h"
+
+#include <QActionGroup>
 #include <QApplication>
+#include <QJsonDocument>
 #include <QPaintEvent>
+#include <QPromise>
+#include <QScopeGuard>
 #include <QStyleOptionMenuItem>
 #include <QStylePainter>
+#include <QThreadPool>
 #include <QWidgetAction>
+#include <QWindow>
 #if _WIN32
 #	pragma comment( lib, "dwmapi.lib" )
 #	include "dwmapi.h"
@@ -61,11 +69,11 @@ constexpr QSize fromPoint( const QPoint &a )
 	return { a.x(), a.y() };
 }
 
-__forceinline QPointF qSinCos( qreal radians )
+Q_ALWAYS_INLINE QPointF qSinCos( qreal radians )
 {
 	return QPointF{ qSin( radians ), qCos( radians ) };
 }
-__forceinline qreal smoothStep( qreal t, qreal t0 = 0., qreal t1 = 1. )
+Q_ALWAYS_INLINE qreal smoothStep( qreal t, qreal t0 = 0., qreal t1 = 1. )
 {
 	auto a = qMax( 0., qMin( 1., ( t - t0 ) / ( t1 - t0 ) ) );
 	return a * a * ( 3 - 2 * a );
@@ -103,16 +111,31 @@ QAction *QPieMenu::execPieStartRange( QPoint pos, float phi0, float dphimax )
 	_initData._start0			 = phi0;
 	_initData._max0				 = qAbs( dphimax );
 	_initData._negativeDirection = ( dphimax < 0.f );
-	createStillData();
-	_actionRectsDirty = true;
+	if ( _layoutPending ) relayout();
+	else createStillData(), _actionRectsDirty = true;
 	return exec( pos );
 }
 
 QSize QPieMenu::sizeHint() const
 {
+	// QMenu fragt vor dem Anzeigen nach der Größe - bis dahin muss das Layout stehen
+	const_cast< QPieMenu * >( this )->ensureLayout();
 	return _boundingRect.size();
 }
 
+void QPieMenu::endUpdate()
+{
+	if ( _updateDepth > 0 && --_updateDepth == 0 ) ensureLayout();
+}
+
+void QPieMenu::relayout()
+{
+	_layoutPending = false;
+	calculatePieDataSizes();
+	createStillData();
+	_actionRectsDirty = true;
+}
+
 void QPieMenu::setVisible( bool vis )
 {
 	if ( vis != isVisible() ) initVisible( vis );
@@ -128,13 +151,10 @@ QAction *QPieMenu::actionAt( const QPoint &pt ) const
 
 int QPieMenu::actionIndexAt( const QPoint &pt ) const
 {
-	// Elegant way of checking this: backwards.
-	// If no elements are left, the loop counter already contains the result.
-	int i( _actionRects.count() - 1 );
-	do
-		if ( _actionRects[ i ].contains( pt ) ) return i;
-	while ( 0 < i-- );
-	return i;
+	// Box-Abstand <= 0 heißt "drin" - hier zählen auch Separatoren mit
+	int d;
+	auto i = PieSimd::kernels().minBoxDistance( _data.hitRects(), PieRectLanes::SkipPad, pt, &d );
+	return d <= 0 ? i : -1;
 }
 
 bool QPieMenu::event( QEvent *e )
@@ -144,6 +164,12 @@ bool QPieMenu::event( QEvent *e )
 		case QEvent::ApplicationPaletteChange: [[fallthru]];
 		case QEvent::PaletteChange: [[fallthru]];
 		case QEvent::StyleChange: readStyleData(); break;
+		// Gesammelte Action-Änderungen abarbeiten (siehe actionEvent)
+		case QEvent::LayoutRequest:
+			// Nur, was die Action-Events angefordert haben - vorbereitete Größen (_stillDirty)
+			// bekommen ihre Ruhepositionen erst mit den Vorgaben von showAsChild()
+			if ( _updateDepth == 0 && _layoutPending ) relayout();
+			break;
 #if _WIN32
 			// Ein Drop-Shadow um das Menu herum sieht nicht brauchbar aus, deshalb
 			// entferne ich zumindest unter Windows den DropShadow tief in der WinAPI
@@ -186,9 +212,18 @@ void QPieMenu::actionEvent( QActionEvent *event )
 	// Egal was das Event besagt, unsere Actions haben sich invalidisiert.
 	//
 	// ToDo für später: Animation beim Einfügen/Entfernen
-	calculatePieDataSizes();
-	createStillData();
-	_actionRectsDirty = true;
+	// Die Grundgröße steckt im Cache-Schlüssel - Boxen, deren Größe sich durch den neuen Tabstopp
+	// ändert, fallen also von selbst heraus.  Verwerfen muss ich nur die geänderte Action.
+	// Entfernte Actions ebenso - ihre Adresse könnte später wiederverwendet werden.
+	if ( event->type() != QEvent::ActionAdded ) invalidateItemCache( event->action() );
+	// Neu berechnet wird aber nicht für jedes einzelne Event (50x addAction wären 50 komplette
+	// Durchläufe), sondern einmal, wenn der LayoutRequest ankommt - oder vorher, falls jemand die
+	// Daten braucht (Paint, Show, sizeHint, exec).
+	if ( !_layoutPending )
+	{
+		_layoutPending = true;
+		QCoreApplication::postEvent( this, new QEvent( QEvent::LayoutRequest ) );
+	}
 	event->accept();
 	// QMenuPrivate at least needs to know about whatever they think is needed
 	QMenu::actionEvent( event );
@@ -197,9 +232,8 @@ void QPieMenu::actionEvent( QActionEvent *event )
 void QPieMenu::paintEvent( QPaintEvent *e )
 {
 	updateCurrentVisuals();
-	QStylePainter		 p( this );
-	QStyleOptionMenuItem opt;
-	auto				 ac = actions().count();
+	QStylePainter p( this );
+	auto		  ac = actions().count();
 	p.translate( -_boundingRect.topLeft() );
 
 	// SelectionRect
@@ -214,21 +248,77 @@ void QPieMenu::paintEvent( QPaintEvent *e )
 		p.drawRoundedRect( _selRect.first, r, r );
 	}
 
-	// Elemente
-	for ( int i( 0 ); i < ac; ++i )
+	// Elemente - nur die, die im neu zu zeichnenden Bereich liegen.  Gerendert wird über den
+	// Cache, hier wird nur noch mit Opacity geblittet.  Liegt die Skalierung zwischen zwei
+	// Rasterstufen, wird die Pixmap minimal gestreckt.
+	const auto dirty = e->region().translated( _boundingRect.topLeft() );
+	const auto dpr	 = devicePixelRatioF();
+	p.setRenderHint( QPainter::SmoothPixmapTransform );
+	for ( int i( 0 ); i < ac && i < _data.count(); ++i )
 	{
-		initStyleOption( &opt, actions().at( i ) );
-		opt.state.setFlag( QStyle::State_Selected,
-						   ( i == _hoverId ) && !_selRectAnimiert.isActive() );
-		opt.rect = _actionRects[ i ].marginsAdded( _styleData.menuMargins );
+		auto rc = _actionRects[ i ].marginsAdded( _styleData.menuMargins );
+		if ( !dirty.intersects( rc ) ) continue;
+		auto sel = ( i == _hoverId ) && !_anim.isActive( PieAnimationDriver::SelRect );
 		p.setOpacity( _actionRenderData[ i ].x() );
-		// ToDo: Benutze den Skalierfaktor "_actionRenderData[ i ].y()" korrekt.
-		//  z.B.: das Folgende (was schon mal sehr gut geht!)
-		opt.font.setPointSizeF( opt.font.pointSizeF() * _actionRenderData[ i ].y() );
-		p.drawPrimitive( QStyle::PE_PanelMenu, opt );
-		opt.rect = opt.rect.marginsRemoved( _styleData.menuMargins );
-		p.drawControl( QStyle::CE_MenuItem, opt );
+		p.drawPixmap( rc, itemPixmap( i, sel, _actionRenderData[ i ].y(), dpr ) );
 	}
+	if ( _anzeigeNs )
+		latency( _anzeigeVon ).record( PieAnimationDriver::now() - _anzeigeNs ), _anzeigeNs = 0;
+}
+
+PieLatencyHistogram &QPieMenu::latency( LatencySource s )
+{
+	static PieLatencyHistogram h[ 2 ];
+	return h[ int( s ) ];
+}
+
+QByteArray QPieMenu::latencyJson()
+{
+	return QJsonDocument( QJsonObject{ { "mouse", latency( LatencySource::Mouse ).toJson() },
+									   { "key", latency( LatencySource::Key ).toJson() } } )
+		.toJson( QJsonDocument::Compact );
+}
+
+QPixmap QPieMenu::itemPixmap( int i, bool selected, qreal scale, qreal dpr )
+{
+	auto	   a = actions().at( i );
+	PieItemKey key{ a,
+					_data[ i ].w,
+					_data[ i ].h,
+					int( selected ) | int( selected && _mouseDown ) << 1 | int( isEnabled() ) << 2,
+					qRound( dpr * 100. ),
+					qRound( scale * 16. ) };
+	if ( auto pm = _itemCache.object( key ) ) return *pm;
+
+	QStyleOptionMenuItem opt;
+	initStyleOption( &opt, a );
+	// Wie QMenu::initStyleOption(): die gewählte Box bei gedrückter Maustaste "eingedrückt" -
+	// aus dem Schlüssel, damit Cache und Bild zusammenpassen
+	opt.state.setFlag( QStyle::State_Selected, key.state & 1 );
+	opt.state.setFlag( QStyle::State_Sunken, key.state & 2 );
+	// Die Skalierung wirkt über die Schriftgröße (was schon mal sehr gut geht!)
+	auto s = key.scale / 16.;
+	opt.font.setPointSizeF( opt.font.pointSizeF() * s );
+	QRect	r{ {}, ( s * QSizeF( _data[ i ] ) ).toSize().grownBy( _styleData.menuMargins ) };
+	QPixmap pm( ( QSizeF( r.size() ) * dpr ).toSize() );
+	pm.setDevicePixelRatio( dpr );
+	pm.fill( Qt::transparent );
+	{
+		QPainter p( &pm );
+		opt.rect = r;
+		style()->drawPrimitive( QStyle::PE_PanelMenu, &opt, &p, this );
+		opt.rect = r.marginsRemoved( _styleData.menuMargins );
+		style()->drawControl( QStyle::CE_MenuItem, &opt, &p, this );
+	}
+	_itemCache.insert( key, new QPixmap( pm ), qMax( 1ll, pm.width() * pm.height() * 4ll >> 10 ) );
+	return pm;
+}
+
+void QPieMenu::invalidateItemCache( const QAction *a )
+{
+	if ( !a ) return _itemCache.clear();
+	for ( const auto &k : _itemCache.keys() )
+		if ( k.a == a ) _itemCache.remove( k );
 }
 
 void QPieMenu::showEvent( QShowEvent *e )
@@ -242,13 +332,103 @@ void QPieMenu::showEvent( QShowEvent *e )
 }
 
 void QPieMenu::mouseMoveEvent( QMouseEvent *e )
+{
+	if ( _kbdOvr.isActive() ) return QWidget::mouseMoveEvent( e );
+	// Der Strich wird am rohen Event geprüft - das Absteigen soll keinen Frame warten
+	if ( _initData._strokeMode && e->buttons() != Qt::NoButton )
+	{
+		_strich = true;
+		if ( strichAuswerten( e->position().toPoint() + _boundingRect.topLeft(), false ) )
+			return e->accept();
+	}
+	// Mäuse mit 1000 Hz und Tablets liefern weit mehr Bewegungen als Frames.  Hier wird nur der
+	// neueste Stand gemerkt - ausgewertet wird einmal je Frame (zeigerAuswerten()).
+	++_inputStats.moves;
+	if ( _anim.isActive( PieAnimationDriver::Zeiger ) ) ++_inputStats.merged;
+	// Bei zusammengefassten Bewegungen zählt die älteste: so lange hat die Reaktion gedauert
+	if ( !_eingangNs ) _eingangNs = PieAnimationDriver::now(), _eingangVon = LatencySource::Mouse;
+	_zeigerPos = e->position().toPoint() + _boundingRect.topLeft();
+	_zeigerTs  = e->timestamp();
+	// Geschwindigkeit (px/ms) aus den Event-Zeitstempeln, geglättet.  Bei 1000 Hz liegen die
+	// Events nur 1 ms auseinander - erst ab 4 ms Abstand ist die Richtung brauchbar.
+	if ( auto dt = qint64( _zeigerTs - _vTs ); dt >= 4 || dt < 0 || !_vTs )
+	{
+		_zeigerV = dt > 0 && dt < 100 && _vTs
+					 ? 0.5 * _zeigerV + 0.5 * QPointF( _zeigerPos - _vPos ) / dt
+					 : QPointF();
+		_vPos = _zeigerPos, _vTs = _zeigerTs;
+	}
+	_anim.start( PieAnimationDriver::Zeiger );
+	e->accept();
+}
+
+int QPieMenu::vorhersageMs() const
+{
+	// Zum Vergleichen: PIEMENU_PREDICT_MS überschreibt die Init-Daten, 0 schaltet ab
+	static const int env = [] {
+		bool ok;
+		auto v = qEnvironmentVariableIntValue( "PIEMENU_PREDICT_MS", &ok );
+		return ok ? qMax( 0, v ) : -1;
+	}();
+	return env >= 0 ? env : int( _initData._predictMs );
+}
+
+qreal QPieMenu::totzone() const
+{
+	// -> ich möchte einen kleinen, nicht-reaktiven Kreis rund um den Mittelpunkt bewahren
+	return qMax( 0.5 * qMin( _avgSz.width(), _avgSz.height() ), 2. * _styleData.sp );
+}
+
+int QPieMenu::zielBei( QPoint p, qreal &di, bool &hit, bool &closeBy, int &wi )
+{
+	int	  id( -1 );
+	qreal r	  = _data.r();
+	bool  out = qSqrt( QPoint::dotProduct( p, p ) ) >= totzone();
+	// Testaufgabe #26 - atan2-test => stelle die Winkel-nächste ID fest (Binärsuche im
+	// Winkel-Index), der Hit-Test prüft dann nur noch deren Nachbarn
+	auto  pos = winkelNaechster( qAtan2( p.x(), p.y() ) );
+	wi		  = pos < 0 ? -1 : _winkelIndex[ pos ].id;
+	hit		  = hitTest( p, di, id, pos );
+	closeBy	  = !hit && out && ( di <= 2 * r ) && ( id != -1 );
+	if ( closeBy && di > fromSize( _actionRects[ id ].size() ).manhattanLength() * 0.5 ) id = wi;
+	return id;
+}
+
+void QPieMenu::zoomMessung( int id )
+{
+	// Gemessen wird vom Eintritt in die Nähe eines Elements (Hit oder Close-By) bis es voll
+	// gezoomt ist.  Verlässt der Zeiger es vorher, zählt der Versuch nicht.
+	auto voll = [ this ]( int i ) { return _actionRenderData.at( i ).y() >= SCALE_MAX - 1e-3; };
+	if ( id != _messId )
+	{
+		_messId = id, _messStart = id < 0 ? 0 : PieAnimationDriver::now();
+		if ( id < 0 || !voll( id ) ) return;
+	} else if ( !_messStart || id < 0 || !voll( id ) ) return;
+	auto ns = PieAnimationDriver::now() - _messStart;
+	++_inputStats.zooms, _inputStats.zoomNs += ns, _messStart = 0;
+#ifdef DEBUG_EVENTS
+	qDebug() << "QPieMenu" << title() << "Zoom auf" << id << "nach" << ns / 1e6
+			 << "ms - Vorhersage" << vorhersageMs() << "ms";
+#endif
+}
+
+void QPieMenu::zeigerNachholen()
+{
+	// Vor Klicks muss der Hover-Zustand zur letzten Mausposition passen
+	if ( !_anim.isActive( PieAnimationDriver::Zeiger ) ) return;
+	_anim.stop( PieAnimationDriver::Zeiger );
+	if ( zeigerAuswerten() ) update();
+}
+
+bool QPieMenu::zeigerAuswerten()
 {
 	auto acc = !_kbdOvr.isActive();
 	if ( acc )
 	{
+		++_inputStats.evaluated;
 		// Nur, wenn es sich wirklich um eine Bewegung handelt, stelle ich die aktuellen Daten zur
 		// Verfügung und werte sie aus.
-		auto p = e->position().toPoint() + _boundingRect.topLeft();
+		auto p = _zeigerPos;
 		if ( _lastPos != p )
 		{
 			_lastPos = p;
@@ -256,60 +436,78 @@ void QPieMenu::mouseMoveEvent( QMouseEvent *e )
 			// Action Rects aktualisieren
 			updateCurrentVisuals();
 			// Finde die nächstgelegene Aktion und den Abstand zum Mittelpunkt durch den Hit-Test
-			int	  id( -1 );
-			// -> ich möchte einen kleinen, nicht-reaktiven Kreis rund um den Mittelpunkt bewahren
-			qreal r	  = _data.r(), d2( std::numeric_limits< qreal >::max() ), tmpD;
-			bool  out = _lastDm
-					   >= qMax( 0.5 * qMin( _avgSz.width(), _avgSz.height() ), 2. * _styleData.sp );
-			bool hit	 = hitTest( p, _lastDi, id );
-			bool closeBy = !hit && out && ( _lastDi <= 2 * r ) && ( id != -1 );
-			// Testaufgabe #26 - atan2-test => stelle die Winkel-nächste ID fest
-			auto _lastW	 = qAtan2( p.x(), p.y() );
-			_lastWi		 = -1;
-			for ( auto i( 0ll ), c( _data.count() ); i < c; ++i )
-				if ( !actions().at( i )->isSeparator()
-					 && d2 > ( tmpD = qAbs( distance< M_PI >( _lastW, _data[ i ].a ) ) ) )
-					d2 = tmpD, _lastWi = i;
-			if ( closeBy
-				 && _lastDi > fromSize( _actionRects[ id ].size() ).manhattanLength() * 0.5 )
-				id = _lastWi;
-			// Alle Informationen sind beschafft und Schlussfolgerungen stehen bereit
-			switch ( _state )
+			bool   hit, closeBy;
+			int	   id = zielBei( p, _lastDi, hit, closeBy, _lastWi );
+			SmData e;
+			e.dM = _lastDm, e.dI = _lastDi, e.id = id;
+			zoomMessung( hit || closeBy ? id : -1 );
+			// Alle Informationen sind beschafft - was daraus folgt, steht in States.scxml
+			acc = zustandsEvent( PieStateTable::mouseMove, e ) > 0;
+			// Vorhersage: wo ist der Zeiger in ein paar ms?  Liegt er dort nahe an einem anderen
+			// Element, werden dessen Zoom-Ziele schon jetzt berechnet - der Zustand bleibt, wie er
+			// ist.  Erst wenn die echte Auswertung dort ankommt, übernimmt createZoom() sie.
+			if ( auto ms = vorhersageMs(); !hit && ms && !_zeigerV.isNull() )
 			{
-				case PieMenuStatus::still:
-					// Der Priorität nach prüfen: hover, closeby
-					if ( hit ) initHover( id );
-					else if ( closeBy ) initCloseBy( id );
-					else acc = false;
-					break;
-				case PieMenuStatus::closeby:
-					if ( hit ) initHover( id );
-					else if ( !closeBy ) initStill();
-					else if ( _folgeId != id ) initCloseBy( id );
-					else acc = false;
-					break;
-				case PieMenuStatus::hover:
-					if ( !hit ) // Kein Hover mehr? Kann dennoch zu 2 anderen Stati wechseln...
-					{
-						initHover();
-						if ( closeBy ) initCloseBy( id );
-						else initStill();
-					} else if ( id != _hoverId ) initHover( id );
-					break;
-				// In allen anderen Stati ist hier (vorerst) nichts zu tun.
-				case PieMenuStatus::item_active: [[fallthru]];
-				default: acc = false; break;
+				// höchstens eine Boxgröße weit - sonst springt die Vorhersage über Elemente hinweg
+				auto  v		 = _zeigerV * ms;
+				qreal grenze = qMax( _avgSz.width(), _avgSz.height() );
+				qreal l		 = qSqrt( QPointF::dotProduct( v, v ) );
+				if ( l > grenze ) v *= grenze / l;
+				qreal di;
+				bool  vHit, vCloseBy;
+				int	  wi, vid = zielBei( p + v.toPoint(), di, vHit, vCloseBy, wi );
+				if ( ( vHit || vCloseBy ) && vid != id && vid != _folgeId && vid != _vorZoom.id )
+					_vorZoom = { vid, zoomZiele( vid ) };
 			}
-			if ( acc ) update();
 		} else acc = false;
 	}
-	if ( acc ) e->accept();
-	else QWidget::mouseMoveEvent( e );
+	// Die Eingabe ist verarbeitet - hat sie nichts ausgelöst, wird sie auch nicht gemessen
+	if ( _eingangVon == LatencySource::Mouse ) _eingangNs = 0;
+	return acc;
+}
+
+int QPieMenu::zustandsEvent( PieStateTable::Event ev, const SmData &e )
+{
+	// Die Übergänge der Tabelle auf die init*()-Methoden abbilden.  Die Tastatur-Region spiegelt
+	// nur _kbdOvr, dessen Timer kümmert sich schon um das Timeout - senden/abbrechen bleiben leer.
+	struct Hook
+	{
+		QPieMenu *m;
+		void	  uebergang( PieStateTable::State von, PieStateTable::State nach, const SmData &d )
+		{
+			if ( von == PieStateTable::selected && nach != PieStateTable::selected ) m->initHover();
+			switch ( nach )
+			{
+				case PieStateTable::still: m->initStill(); break;
+				case PieStateTable::closeBy: m->initCloseBy( int( d.id ) ); break;
+				case PieStateTable::selected: m->initHover( int( d.id ) ); break;
+				default: break;
+			}
+		}
+		void senden( PieStateTable::Event, int ) {}
+		void abbrechen( PieStateTable::Event ) {}
+	} hook{ this };
+	// Die Konfiguration ergibt sich aus dem, was das Menü gerade tut - ebenso die IDs, die
+	// initHover()/initCloseBy() nebenbei setzen
+	auto haupt = PieStateTable::hidden;
+	switch ( _state )
+	{
+		case PieMenuStatus::still: haupt = PieStateTable::still; break;
+		case PieMenuStatus::closeby: haupt = PieStateTable::closeBy; break;
+		case PieMenuStatus::hover: haupt = PieStateTable::selected; break;
+		case PieMenuStatus::item_active: haupt = PieStateTable::subMenu; break;
+		default: break;
+	}
+	_sm.keyOvr = _kbdOvr.isActive(), _sm.selId = _hoverId, _sm.folgeId = _folgeId;
+	PieStates::Maschine< Hook > sm( _sm, hook );
+	sm.setzen( { haupt, _sm.keyOvr ? PieStateTable::Active : PieStateTable::Inactive } );
+	return sm.ereignis( ev, e );
 }
 
 void QPieMenu::mousePressEvent( QMouseEvent *e )
 {
 	if ( _kbdOvr.isActive() ) return e->ignore();
+	zeigerNachholen();
 	qDebug() << "QPieMenu::mousePressEvent(" << e << ")";
 	_mouseDown	= true;
 	auto p		= e->pos() + _boundingRect.topLeft();
@@ -338,7 +536,12 @@ void QPieMenu::mousePressEvent( QMouseEvent *e )
 
 void QPieMenu::mouseReleaseEvent( QMouseEvent *e )
 {
+	// Ein Strich braucht weder Hover noch ein vorheriges mousePressEvent in diesem Menü
+	if ( _strich && !_kbdOvr.isActive()
+		 && strichAuswerten( e->position().toPoint() + _boundingRect.topLeft(), true ) )
+		return e->accept();
 	if ( _kbdOvr.isActive() || !_mouseDown ) return e->ignore();
+	zeigerNachholen();
 	qDebug() << "QPieMenu::mouseReleaseEvent(" << e << ")";
 	_mouseDown	= false;
 	auto p		= e->pos() + _boundingRect.topLeft();
@@ -351,13 +554,7 @@ void QPieMenu::mouseReleaseEvent( QMouseEvent *e )
 		if ( auto am = qobject_cast< QPieMenu * >( a->menu() ) )
 		{
 			initActive();
-		} else {
-			setActiveAction( a );
-			QKeyEvent ev( QEvent::Type::KeyPress, Qt::Key_Return, Qt::NoModifier );
-			QMenu::keyPressEvent( &ev );
-			initVisible( false );
-			if ( _causedMenu ) _causedMenu->childHidden( this, true );
-		}
+		} else ausloesen( _hoverId );
 	} else if ( _state != PieMenuStatus::hidden ) {
 		initVisible( false );
 		if ( _causedMenu ) _causedMenu->childHidden( this, false );
@@ -365,9 +562,57 @@ void QPieMenu::mouseReleaseEvent( QMouseEvent *e )
 	e->accept();
 }
 
+void QPieMenu::ausloesen( int index )
+{
+	setActiveAction( actions().at( index ) );
+	QKeyEvent ev( QEvent::Type::KeyPress, Qt::Key_Return, Qt::NoModifier );
+	QMenu::keyPressEvent( &ev );
+	initVisible( false );
+	if ( _causedMenu ) _causedMenu->childHidden( this, true );
+}
+
+bool QPieMenu::strichAuswerten( QPoint p, bool loslassen )
+{
+	// Kein Hit-Test, keine _actionRects: nur der Winkel-Index der Ruhewinkel.  Wer ein Menü kennt,
+	// muss nicht warten, bis es zu sehen ist.
+	ensureLayout();
+	auto d	 = qSqrt( QPoint::dotProduct( p, p ) );
+	auto pos = winkelNaechster( qAtan2( p.x(), p.y() ) );
+	// Unterhalb der halben Ruhe-Distanz ist die Richtung noch nicht gemeint
+	if ( pos < 0 || d < qMax( 0.5 * _data.r(), 2. * _styleData.sp ) ) return false;
+	// Weit jenseits der Ruhepositionen losgelassen: das war kein Strich, sondern Abbrechen
+	if ( loslassen && d > _data.r() + qMax( _avgSz.width(), _avgSz.height() ) )
+	{
+		_strich = false;
+		initVisible( false );
+		if ( _causedMenu ) _causedMenu->childHidden( this, false );
+		return true;
+	}
+	auto id = _winkelIndex[ pos ].id;
+	auto a	= actions().at( id );
+	if ( !a->isEnabled() ) return false;
+	// Während der Bewegung: erst jenseits des Rings der Ruhepositionen ins Submenü
+	if ( !loslassen && !( a->menu() && d >= _data.r() ) ) return false;
+#ifdef DEBUG_EVENTS
+	qDebug() << "QPieMenu" << title() << "Strich auf" << id << "nach"
+			 << ( PieAnimationDriver::now() - _gezeigtNs ) / 1e6 << "ms";
+#endif
+	_strich	 = false;
+	_folgeId = _hoverId = id;
+	if ( !a->menu() ) return ausloesen( id ), true;
+	// Wie initActive() - die Boxen sind evtl. noch unterwegs, es zählt die Ruheposition
+	auto r = zoomRect( id );
+	startSelRect( r );
+	showChild( id, r );
+	setState( PieMenuStatus::item_active );
+	return true;
+}
+
 void QPieMenu::keyPressEvent( QKeyEvent *e )
 {
-	enum { none, prev, next, use, out } dir;
+	_eingangNs = PieAnimationDriver::now(), _eingangVon = LatencySource::Key;
+	auto ende  = qScopeGuard( [ this ] { _eingangNs = 0; } );
+	enum { none, prev, next, use, out, kompass } dir;
 	switch ( e->key() )
 	{
 		case Qt::Key_ApplicationLeft: [[fallthru]];
@@ -386,7 +631,13 @@ void QPieMenu::keyPressEvent( QKeyEvent *e )
 		case Qt::Key_Enter: dir = use; break;
 		case Qt::Key_Up: dir = prev; break;
 		case Qt::Key_Down: dir = next; break;
-		default: dir = none; break;
+		default:
+			// Ziffern vom Nummernblock zeigen direkt in eine der 8 Richtungen (5 = Mitte)
+			dir = e->modifiers().testFlag( Qt::KeypadModifier ) && e->key() >= Qt::Key_1
+						  && e->key() <= Qt::Key_9 && e->key() != Qt::Key_5
+					? kompass
+					: none;
+			break;
 	}
 	switch ( dir )
 	{
@@ -409,12 +660,30 @@ void QPieMenu::keyPressEvent( QKeyEvent *e )
 			}
 			break;
 		case prev: [[fallthru]];
-		case next:
-			focusNextPrevChild( dir == next );
-			_hoverId = actionIndex( activeAction() );
+		case next: [[fallthru]];
+		case kompass:
+		{
+			// "next" folgt der Reihenfolge der Actions, also der Legerichtung des Menüs.  Ohne
+			// Auswahl geht es am Anfang bzw. Ende des Bogens los.
+			ensureLayout();
+			int	 ziel = -1;
+			auto cw	  = ( dir == next ) == _initData._negativeDirection;
+			if ( dir == kompass ) ziel = _kompass[ e->key() - Qt::Key_1 ];
+			else if ( _hoverId >= 0 && _hoverId < _nachbarCw.count() )
+				ziel = ( cw ? _nachbarCw : _nachbarCcw )[ _hoverId ];
+			else if ( !_winkelIndex.isEmpty() )
+			{
+				auto pos = winkelNaechster( _initData._start0 );
+				ziel	 = _winkelIndex[ pos ].id;
+				if ( dir == prev ) ziel = ( cw ? _nachbarCw : _nachbarCcw )[ ziel ];
+			}
+			if ( ziel < 0 ) break;
+			_hoverId = ziel;
+			setActiveAction( actions().at( ziel ) );
 			_kbdOvr.start( _initData._subMenuDelayMS * 2, this );
 			initActive();
 			break;
+		}
 		case none: return QMenu::keyPressEvent( e );
 	}
 	e->accept();
@@ -431,26 +700,74 @@ void QPieMenu::timerEvent( QTimerEvent *e )
 		_kbdOvr.stop();
 		initHover( _hoverId );
 		qDebug() << "END_KEYBOARD_OVERRIDE";
-	} else {
-		if ( tid == _selRectAnimiert.timerId() ) _selRectDirty = true, update();
-		else if ( tid == _rectsAnimiert.timerId() )
+	} else return QMenu::timerEvent( e );
+	e->accept();
+}
+
+QRegion QPieMenu::animationFrame( qint64 now )
+{
+	// Beide Animationen laufen mit demselben Zeitstempel.  Neu gezeichnet wird nur, was sich
+	// bewegt hat: alte und neue Position jedes veränderten Elements und des Selection Rects.
+	_damage.clear();
+	// Zuerst die gesammelten Mausbewegungen: ein Zustandswechsel startet ggf. neue Animationen,
+	// die dann schon in diesem Frame loslaufen.  Er ändert die Darstellung aber überall.
+	bool alles = false;
+	if ( _anim.isActive( PieAnimationDriver::Zeiger ) )
+		_anim.stop( PieAnimationDriver::Zeiger ), alles = zeigerAuswerten();
+	if ( _anim.isActive( PieAnimationDriver::SelRect ) )
+	{
+		auto x	 = smoothStep( qreal( now - _selRectStart ) / ( 1e6 * _initData._animBaseDur ) );
+		auto alt = _selRect;
+		_selRect( x, _srS, _srE );
+		if ( alt.first != _selRect.first || alt.second != _selRect.second )
+			for ( const auto &r : { alt.first, _selRect.first } )
+				if ( r.isValid() ) _damage.append( r.toAlignedRect() );
+		// Am Ende wechselt das Hover-Element in den "Selected"-Zustand -> alles neu, aber erst
+		// nach dem Schritt der Rects - die laufen in diesem Frame trotzdem weiter.
+		if ( x >= 1. ) _anim.stop( PieAnimationDriver::SelRect ), alles = true;
+	}
+	if ( _anim.isActive( PieAnimationDriver::Rects ) )
+	{
+		_actionRectsDirty = false;
+		auto fertig		  = _data.update( _actionRects, _actionRenderData, now, &_damage );
+		if ( _messStart ) zoomMessung( _messId );
+		if ( fertig )
 		{
-			if ( _data.update( _actionRects, _actionRenderData ) )
-			{
-				_rectsAnimiert.stop();
-				// Verschobenes Hiding ...
-				if ( _state == PieMenuStatus::hidden ) initVisible( false );
-			}
-			_actionRectsDirty = false;
-			update();
-		} else return QMenu::timerEvent( e );
+			_anim.stop( PieAnimationDriver::Rects );
+			// Verschobenes Hiding ...
+			if ( _state == PieMenuStatus::hidden ) initVisible( false );
+		}
 	}
-	e->accept();
+	if ( alles ) return rect();
+	// Boxen werden mit den Menü-Rändern gemalt, dazu ein Pixel für das Antialiasing
+	QRegion r;
+	auto	m = _styleData.menuMargins + QMargins( 1, 1, 1, 1 );
+	for ( const auto &d : std::as_const( _damage ) )
+		r += d.marginsAdded( m ).translated( -_boundingRect.topLeft() );
+	return r;
 }
 
 void QPieMenu::hideEvent( QHideEvent *e )
 {
 	qDebug() << "QPieMenu" << title() << "::hideEvent( " << e << " ) ";
+#ifdef DEBUG_EVENTS
+	qDebug() << "\tMausbewegungen:" << _inputStats.moves << "davon zusammengefasst:"
+			 << _inputStats.merged << "ausgewertet:" << _inputStats.evaluated;
+	if ( _inputStats.zooms )
+		qDebug() << "\tZoom nach Eintritt: Ø" << _inputStats.zoomNs / 1e6 / _inputStats.zooms
+				 << "ms bei" << _inputStats.zooms << "Zooms, Vorhersage" << vorhersageMs()
+				 << "ms, vorhergesagt:" << _inputStats.predicted;
+	for ( auto q : { LatencySource::Mouse, LatencySource::Key } )
+		if ( const auto &h = latency( q ); h.count() )
+			qDebug() << "\tReaktionszeit" << ( q == LatencySource::Mouse ? "Maus" : "Tastatur" )
+					 << "p50/p95/p99:" << h.percentileUs( 0.5 ) << h.percentileUs( 0.95 )
+					 << h.percentileUs( 0.99 ) << "µs bei" << h.count() << "Messungen";
+#endif
+	_anim.stop( PieAnimationDriver::Zeiger );
+	_vorZoom = {}, _messId = -1, _messStart = 0;
+	// Die Änderung wird nicht mehr gezeigt
+	_eingangNs = _anzeigeNs = 0;
+	_strich	   = false;
 	QMenu::hideEvent( e );
 }
 
@@ -476,6 +793,7 @@ void QPieMenu::readStyleData()
 	_selRect.second	  = _hoverId == -1 ? _styleData.HLtransparent : _styleData.HL;
 	// Es wurden auch Größen und Margins neu gelesen -> die rects sind vmtl. dirty.
 	_actionRectsDirty = true;
+	invalidateItemCache();
 }
 
 void QPieMenu::calculatePieDataSizes()
@@ -483,15 +801,16 @@ void QPieMenu::calculatePieDataSizes()
 	// Alle Größen sind voneinander abhängig, wenn wir einen konsistenten Stil (wie ihn Menüs
 	// nunmal haben sollten) mit zumindest gleichem Tabstopp verwenden wollen.  Da wir alle
 	// anfassen müssen, können wir auch gleich immer alle berechnen.
-	QStyleOptionMenuItem opt;
-	QAction				*action;
-	QSize				 sz, allSz;
-	int					 tab = 0, noSzItems = 0, ac = actions().count();
+	// Die eigentliche Vermessung steckt in measure() und wird prozessweit gecached.
+	QAction *action;
+	QSize	 sz, allSz;
+	int		 tab = 0, noSzItems = 0, ac = actions().count();
+	bool	 checkables = false;
+	for ( auto a : actions() ) checkables |= a->isCheckable();
 	// Schritt #1: Tabstopp suchen
 	for ( int i( 0 ); i < ac; ++i )
 	{
 		action = actions().at( i );
-		initStyleOption( &opt, action );
 		const bool isSection =
 			action->isSeparator() && ( !action->text().isEmpty() || !action->icon().isNull() );
 		const bool isLücke =
@@ -499,23 +818,8 @@ void QPieMenu::calculatePieDataSizes()
 			|| ( action->isSeparator() && !isSection ) || !action->isVisible();
 		auto w	= qobject_cast< QWidgetAction * >( action );
 		auto ww = w ? w->defaultWidget() : nullptr;
-		if ( ww == nullptr && !isLücke )
-		{
-			// Keine Widget-Action, keine Lücke: also Text und Icon
-			const QFontMetrics &fm = opt.fontMetrics;
-			auto				s  = action->text();
-			auto				t  = s.indexOf( u'\t' );
-			if ( t != -1 )
-			{
-				tab = qMax( tab, fontMetrics().horizontalAdvance( s.mid( t + 1 ) ) );
-				s	= s.left( t );
-			} else if ( action->isShortcutVisibleInContextMenu() || !_initData._isContext ) {
-				QKeySequence seq = action->shortcut();
-				if ( !seq.isEmpty() )
-					tab = qMax( tab,
-								fm.horizontalAdvance( seq.toString( QKeySequence::NativeText ) ) );
-			}
-		}
+		// Keine Widget-Action, keine Lücke: also Text und Icon
+		if ( ww == nullptr && !isLücke ) tab = qMax( tab, measure( action, checkables ).tab );
 	}
 	// Schritt #2: Größen (nach)berechnen
 	bool previousWasSeparator = true;
@@ -526,7 +830,6 @@ void QPieMenu::calculatePieDataSizes()
 	for ( int i( 0 ); i < ac; ++i )
 	{
 		action = actions().at( i );
-		initStyleOption( &opt, action );
 		const bool isSection =
 			action->isSeparator() && ( !action->text().isEmpty() || !action->icon().isNull() );
 		const bool isPlainSep =
@@ -547,24 +850,12 @@ void QPieMenu::calculatePieDataSizes()
 						 .expandedTo( ww->minimumSizeHint() )
 						 .boundedTo( ww->maximumSize() );
 			else if ( !isPlainSep )
-			{
 				// Keine Widget-Action, keine Lücke: also Text und Icon
-				const QFontMetrics &fm = opt.fontMetrics;
-				auto				s  = action->text();
-				sz =
-					fm.boundingRect( QRect(), Qt::TextSingleLine | Qt::TextShowMnemonic, s ).size();
-				QIcon is = action->icon();
-				if ( !is.isNull() )
-				{
-					QSize is_sz = is.actualSize( QSize( _styleData.icone, _styleData.icone ) );
-					if ( is_sz.height() > sz.height() ) sz.setHeight( is_sz.height() );
-				}
-				sz = style()->sizeFromContents( QStyle::CT_MenuItem, &opt, sz, this );
-			}
+				sz = measure( action, checkables ).size;
 			if ( sz.isValid() ) sz.rwidth() += tab;
 			previousWasSeparator = isPlainSep;
 		}
-		_data.append( sz );
+		_data.append( sz, action->isSeparator() || !action->isVisible() );
 		_actionRenderData[ i ] = { 1., 1. };
 		if ( sz.isValid() ) allSz += sz;
 		else ++noSzItems;
@@ -573,7 +864,52 @@ void QPieMenu::calculatePieDataSizes()
 	if ( auto cnt = ac - noSzItems ) _avgSz = allSz / cnt;
 }
 
-qreal QPieMenu::startR( int runde ) const
+QCache< PieMetricsKey, PieMetrics > &QPieMenu::metricsCache()
+{
+	// LRU über alle Menüs - ein Eintrag ist klein, 2048 davon reichen für viele Menüs
+	static QCache< PieMetricsKey, PieMetrics > cache( 2048 );
+	return cache;
+}
+
+PieMetrics QPieMenu::measure( QAction *action, bool menuHasCheckables )
+{
+	const bool	  scVisible = action->isShortcutVisibleInContextMenu() || !_initData._isContext;
+	const auto	  grp		= action->actionGroup();
+	PieMetricsKey key{ style(),
+					   style()->name(),
+					   QWidget::font(),
+					   action->font().resolve( QWidget::font() ),
+					   action->text(),
+					   scVisible ? action->shortcut() : QKeySequence(),
+					   action->icon().cacheKey(),
+					   _styleData.icone,
+					   int( action->isCheckable() ) | int( grp && grp->isExclusive() ) << 1
+						   | int( menuHasCheckables ) << 2 | int( action->isSeparator() ) << 3 };
+	auto		 &cache = metricsCache();
+	if ( auto m = cache.object( key ) ) return *m;
+
+	QStyleOptionMenuItem opt;
+	initStyleOption( &opt, action );
+	const QFontMetrics &fm = opt.fontMetrics;
+	PieMetrics			m;
+	auto				s = action->text();
+	auto				t = s.indexOf( u'\t' );
+	if ( t != -1 ) m.tab = fontMetrics().horizontalAdvance( s.mid( t + 1 ) );
+	else if ( scVisible && !key.shortcut.isEmpty() )
+		m.tab = fm.horizontalAdvance( key.shortcut.toString( QKeySequence::NativeText ) );
+	m.size = fm.boundingRect( QRect(), Qt::TextSingleLine | Qt::TextShowMnemonic, s ).size();
+	QIcon is = action->icon();
+	if ( !is.isNull() )
+	{
+		QSize is_sz = is.actualSize( QSize( _styleData.icone, _styleData.icone ) );
+		if ( is_sz.height() > m.size.height() ) m.size.setHeight( is_sz.height() );
+	}
+	m.size = style()->sizeFromContents( QStyle::CT_MenuItem, &opt, m.size, this );
+	cache.insert( key, new PieMetrics( m ) );
+	return m;
+}
+
+qreal PieLayoutSolver::startR( int runde ) const
 {
 	auto asz = _avgSz;
 	auto avp = fromSize( asz );
@@ -583,9 +919,9 @@ qreal QPieMenu::startR( int runde ) const
 	// Bisher eine gute Schätzung:
 	//  ( AspectRatio * (item_height+spacing) * itemCount ) / floor( winkelÜberdeckung / 90° )
 	// MUSS ÜBERARBEITET WERDEN!!! Zu viele Rechenvorgänge ...
-	auto r0	 = qMax( avp.y(), qMax( _initData._minR,
-									( avp.y() / avp.x() ) * ( asz.height() + _styleData.sp )
-										* actions().count() / qFloor( _initData._max0 / M_PI_2 ) ) );
+	auto r0	 = qMax( avp.y(), qMax( _init._minR, ( avp.y() / avp.x() ) * ( asz.height() + _sp )
+												 * _data.count()
+												 / qFloor( _init._max0 / M_PI_2 ) ) );
 	// Also: 0. - 3. Runde bewegen sich der Radius linear zwischen r0 und r3, falls _minR nicht zu
 	// gross ist
 	if ( r0 < r3 && runde < 4 ) return r0 + runde * ( r3 - r0 ) / 3;
@@ -604,90 +940,244 @@ void QPieMenu::createStillData()
 	// der Anfansgwinkel nicht überdeckt ist.  Dort soll das Menu schliesslich anfangen und nicht
 	// schon längst angefangen haben ... ergo beim Item #0: lastSz = 0, aber berechnen
 
-	int ac = actions().count(), runde = -1, ip, im;
-	if ( _data.count() != ac ) return;
+	_stillDirty = false;
+	if ( _data.count() != actions().count() ) return;
 
-	QRectF rwsd0{ _initData._minR, _initData._start0, 1.f, _initData.dir() }, rwsd{ rwsd0 }, nr;
-	QSizeF lstSz0{ 0., 0. }, lstSz{ lstSz0 };
-	qreal  deltaSum, delta;
-	Intersector< QRectF, QPointF > overlap;
-	bool						   needMoreSpace( false );
-	do {
-		deltaSum = 0., needMoreSpace = false, runde++, overlap.clear();
-		rwsd0.moveLeft( startR( runde ) );
-		// Den Start feststellen: ist der ExecPoint nicht gesetzt, wurde dieses Objekt nicht mit den
-		// Hilfsfunktionen, sondern mit QMenu gestartet -> standard Werte nehmen!
-		if ( _initData._isSubMenu )
+	// Schon einmal gelöst?  Dann nur die Winkel und den Radius übernehmen.
+	auto key = layoutKey( _initData );
+	if ( auto l = layoutCache().object( key ) ) return layoutUebernehmen( *l );
+	// Im Hover vorbereitet (layoutVorbereiten())?  Ist der Worker noch nicht fertig, wird hier auf
+	// ihn gewartet - länger als das Lösen im GUI-Thread dauert das nicht.
+	if ( _vorLayout.isValid() && key == _vorKey )
+	{
+		auto l = new PieLayout( std::exchange( _vorLayout, {} ).result() );
+#ifdef DEBUG_EVENTS
+		qDebug() << "QPieMenu" << title() << "::createStillData: r =" << l->r << "vorbereitet";
+#endif
+		layoutUebernehmen( *l );
+		layoutCache().insert( key, l );
+		return;
+	}
+
+	int	 auswertungen, runden;
+	auto hi = solver().solve( &auswertungen, &runden );
+#ifdef DEBUG_EVENTS
+	qDebug() << "QPieMenu" << title() << "::createStillData: r =" << hi << "nach" << auswertungen
+			 << "Läufen, linear:" << runden + 1;
+#endif
+	// Berechnungen sind abgeschlossen.  Jetzt müssen die Animationsdaten noch in Still-Daten
+	// umgewandelt werden
+	auto l = new PieLayout{ hi, {} };
+	l->angles.reserve( _data.count() );
+	for ( const auto &e : std::as_const( _data ) ) l->angles.append( e.ea );
+	layoutCache().insert( key, l );
+	makeZielStill( hi );
+}
+
+void QPieMenu::layoutUebernehmen( const PieLayout &l )
+{
+	for ( int i = 0, c = _data.count(); i < c; ++i )
+		_data[ i ].er = l.r, _data[ i ].ea = l.angles[ i ], _data[ i ].es = 1.;
+	makeZielStill( l.r );
+}
+
+qreal PieLayoutSolver::solve( int *auswertungen, int *runden )
+{
+	// Radiussuche: Früher wurde der Radius rundenweise linear erhöht (startR( runde )) und jedes
+	// Mal der ganze Lauf wiederholt.  Jetzt wird der passende Radius eingeklammert - Schrittweite
+	// verdoppeln, bis es passt - und dann per Bisektion auf 1 Pixel genau bestimmt.  Das Ergebnis
+	// ist der kleinste passende Radius (bis auf die Toleranz), sofern "passt" monoton im Radius
+	// ist.
+	constexpr qreal toleranz = 1.;
+	int				n		 = 1;
+	qreal			lo = startR( 0 ), hi = lo, schritt = qMax( toleranz, ( startR( 3 ) - lo ) / 3 );
+	if ( !stillFits( lo ) )
+	{
+		bool passt;
+		do {
+			lo = hi, hi += schritt, schritt *= 2, ++n;
+		} while ( !( passt = stillFits( hi ) ) && n < 64 );
+		// Passt es auch beim größten Radius nicht, gibt es nichts einzuklammern - zwischen zwei
+		// unpassenden Radien zu halbieren, brächte nur weitere unpassende.  Es bleibt hi mit
+		// seinen Zieldaten, so gut sie eben sind.
+		if ( !passt ) qWarning() << "PieLayoutSolver: kein passender Radius bis r =" << hi;
+		bool hiAktuell = true; // die Zieldaten stammen von hi
+		while ( passt && hi - lo > toleranz )
 		{
-			// Submenüs erhalten Radius- und Winkel-Angaben vor dem Popup.  Sie sollen von der Mitte
-			// aus berechnet werden, um eine möglichst gleichmäßige Überdeckung zu erhalten.
-			rwsd0.moveTop( _initData._start0 + _initData.dir( 0.5 ) * _initData._max0 );
-			ip = im = ac >> 1;
-			if ( ac % 1 )
-			{ // ungerade Anzahl -> mittlere Option kommt auf den Mittenwinkel
-				lstSz0				 = _data[ ip++ ]; // implizit als QSizeF
-				_data[ im-- ].ziel() = *reinterpret_cast< __m256d * >( &rwsd0 );
-			} else { // gerade Anzahl -> jeweils vom Startwinkel aus losschreiten.
-				--im;
-			}
-		} else {
-			// Standard: nur vorwärts laufen ...
-			im = -2, ip = 0;
+			auto mitte = 0.5 * ( lo + hi );
+			++n;
+			if ( ( hiAktuell = stillFits( mitte ) ) ) hi = mitte;
+			else lo = mitte;
 		}
-		rwsd = rwsd0;
-		rwsd.setHeight( _initData.dir( -1. ) ); // Rückwärts für die erste Runde
-		// ACHTUNG: stepBox wird immer 1x öfter aufgerufen, um die Winkelabdeckung des jew. letzten
-		// Elementes korrekt in die Berechnung mit einzubeziehen.
-		while ( !needMoreSpace && im >= -1 )
+		if ( !hiAktuell ) stillFits( hi ), ++n;
+	}
+	if ( auswertungen ) *auswertungen = n;
+	// Zum Vergleich: so viele Läufe hätte die lineare Suche mindestens gebraucht
+	if ( runden )
+		for ( *runden = 0; *runden < 256 && startR( *runden ) < hi - toleranz; ) ++*runden;
+	return hi;
+}
+
+PieLayout PieLayoutSolver::solve( const PieLayoutKey &k )
+{
+	// Dieselben Daten, die calculatePieDataSizes() und showAsChild() liefern würden - nur eben
+	// aus dem Schlüssel.  Die Skip-Flags braucht die Radiussuche nicht.
+	SuperPolator data;
+	PieInitData	 init;
+	QSize		 allSz;
+	int			 cnt = 0;
+	data.clear( k.sizes.count() );
+	for ( auto sz : k.sizes )
+	{
+		QSize s( qint32( sz >> 32 ), qint32( sz ) );
+		data.append( s );
+		if ( s.isValid() ) allSz += s, ++cnt;
+	}
+	init._start0 = k.start0, init._max0 = k.max0, init._minR = k.minR;
+	init._negativeDirection = k.negativeDirection, init._isSubMenu = k.isSubMenu;
+	PieLayout l{ PieLayoutSolver( data, init, k.sp, cnt ? allSz / cnt : QSize() ).solve(), {} };
+	l.angles.reserve( data.count() );
+	for ( const auto &e : std::as_const( data ) ) l.angles.append( e.ea );
+	return l;
+}
+
+QFuture< PieLayout > PieLayoutSolver::solveInBackground( PieLayoutKey k )
+{
+	// QtConcurrent wird nicht gelinkt - QPromise und der globale Pool aus QtCore reichen
+	auto p = std::make_shared< QPromise< PieLayout > >();
+	auto f = p->future();
+	QThreadPool::globalInstance()->start(
+		[ p, k = std::move( k ) ]
 		{
-			// Schreite rückwärts
-			delta = stepBox( im, rwsd, lstSz );
-			needMoreSpace =
-				( qFuzzyIsNull( delta ) ) || ( deltaSum += qAbs( delta ) > _initData._max0 );
-			if ( im >= 0 )
-			{
-				nr = { {}, rwsd.width() * QSizeF( _data[ im ] ) };
-				nr.moveCenter( rwsd.x() * qSinCos( rwsd.y() ) );
-				needMoreSpace |= !overlap.add( nr );
-			}
+			p->start();
+			p->addResult( solve( k ) );
+			p->finish();
+		} );
+	return f;
+}
+
+PieLayoutKey QPieMenu::layoutKey( const PieInitData &init ) const
+{
+	PieLayoutKey k{ {},
+					init._start0,
+					init._max0,
+					init._minR,
+					_styleData.sp,
+					init._negativeDirection,
+					init._isSubMenu };
+	k.sizes.reserve( _data.count() );
+	for ( const auto &e : _data )
+		k.sizes.append( quint64( quint32( e.w ) ) << 32 | quint32( e.h ) );
+	return k;
+}
+
+QCache< PieLayoutKey, PieLayout > &QPieMenu::layoutCache()
+{
+	// LRU, ein Eintrag je Menü-Variante
+	static QCache< PieLayoutKey, PieLayout > cache( 256 );
+	return cache;
+}
+
+bool PieLayoutSolver::stillFits( qreal r )
+{
+	int	   ac = _data.count(), ip, im;
+	QRectF rwsd0{ r, _init._start0, 1.f, _init.dir() }, rwsd{ rwsd0 }, nr;
+	QSizeF lstSz0{ 0., 0. }, lstSz{ lstSz0 };
+	qreal  deltaSum = 0., delta;
+	SimdIntersector overlap;
+	bool			needMoreSpace( false );
+	// Den Start feststellen: ist der ExecPoint nicht gesetzt, wurde dieses Objekt nicht mit den
+	// Hilfsfunktionen, sondern mit QMenu gestartet -> standard Werte nehmen!
+	if ( _init._isSubMenu )
+	{
+		// Submenüs erhalten Radius- und Winkel-Angaben vor dem Popup.  Sie sollen von der Mitte
+		// aus berechnet werden, um eine möglichst gleichmäßige Überdeckung zu erhalten.
+		rwsd0.moveTop( _init._start0 + _init.dir( 0.5 ) * _init._max0 );
+		ip = im = ac >> 1;
+		if ( ac % 1 )
+		{ // ungerade Anzahl -> mittlere Option kommt auf den Mittenwinkel
+			lstSz0				 = _data[ ip++ ]; // implizit als QSizeF
+			_data[ im-- ].ziel() = { rwsd0.x(), rwsd0.y(), rwsd0.width(), rwsd0.height() };
+		} else { // gerade Anzahl -> jeweils vom Startwinkel aus losschreiten.
 			--im;
 		}
-		rwsd = rwsd0, lstSz = lstSz0;
-		while ( !needMoreSpace && ip <= ac )
+	} else {
+		// Standard: nur vorwärts laufen ...
+		im = -2, ip = 0;
+	}
+	rwsd = rwsd0;
+	rwsd.setHeight( _init.dir( -1. ) ); // Rückwärts für die erste Runde
+	// ACHTUNG: stepBox wird immer 1x öfter aufgerufen, um die Winkelabdeckung des jew. letzten
+	// Elementes korrekt in die Berechnung mit einzubeziehen.
+	while ( !needMoreSpace && im >= -1 )
+	{
+		// Schreite rückwärts
+		delta = stepBox( im, rwsd, lstSz );
+		needMoreSpace =
+			( qFuzzyIsNull( delta ) ) || ( deltaSum += qAbs( delta ) > _init._max0 );
+		if ( im >= 0 )
 		{
-			// Schreite vorwärts
-			delta = stepBox( ip, rwsd, lstSz );
-			needMoreSpace =
-				( qFuzzyIsNull( delta ) ) || ( deltaSum += qAbs( delta ) > _initData._max0 );
-			if ( ip < ac )
-			{
-				nr = { {}, rwsd.width() * QSizeF( _data[ ip ] ) };
-				nr.moveCenter( rwsd.x() * qSinCos( rwsd.y() ) );
-				needMoreSpace |= !overlap.add( nr );
-			}
-			++ip;
+			nr = { {}, rwsd.width() * QSizeF( _data[ im ] ) };
+			nr.moveCenter( rwsd.x() * qSinCos( rwsd.y() ) );
+			needMoreSpace |= !overlap.add( nr );
 		}
-	} while ( needMoreSpace );
-	// Berechnungen sind abgeschlossen.  Jetzt müssen die Animationsdaten noch in Still-Daten
-	// umgewandelt werden
-	makeZielStill( rwsd.x() );
+		--im;
+	}
+	rwsd = rwsd0, lstSz = lstSz0;
+	while ( !needMoreSpace && ip <= ac )
+	{
+		// Schreite vorwärts
+		delta = stepBox( ip, rwsd, lstSz );
+		needMoreSpace =
+			( qFuzzyIsNull( delta ) ) || ( deltaSum += qAbs( delta ) > _init._max0 );
+		if ( ip < ac )
+		{
+			nr = { {}, rwsd.width() * QSizeF( _data[ ip ] ) };
+			nr.moveCenter( rwsd.x() * qSinCos( rwsd.y() ) );
+			needMoreSpace |= !overlap.add( nr );
+		}
+		++ip;
+	}
+	return !needMoreSpace;
 }
 
 void QPieMenu::createZoom()
 {
-	int ac = actions().count(), ip = _folgeId + 1, im = _folgeId - 1;
-	if ( _data.count() != ac ) return;
-	_rectsAnimiert.stop();
+	if ( _data.count() != actions().count() ) return;
+	// Hat die Hover-Vorhersage genau dieses Element vorbereitet, sind die Ziele schon fertig -
+	// eine Vorhersage auf ein anderes Element war falsch und wird verworfen.
+	auto vor	 = std::exchange( _vorZoom, {} );
+	bool treffer = vor.id == _folgeId && vor.ziele.count() == _data.count();
+	auto ziele	 = treffer ? vor.ziele : zoomZiele( _folgeId );
+	if ( treffer ) ++_inputStats.predicted;
 	_data.copyCurrent2Source();
-	// ich möchte das Element _folgeId auf Skalierungsfaktor 1.5 fahren und alle anderen Boxen
+	for ( int i = 0, c = _data.count(); i < c; ++i )
+	{
+		auto &z = _data[ i ].ziel();
+		for ( int k = 0; k < 4; ++k )
+			if ( !qIsNaN( ziele[ i ][ k ] ) ) z[ k ] = ziele[ i ][ k ];
+		_data[ i ].setT( 0., 1. );
+	}
+	_data.startAnimation( _initData._animBaseDur );
+	_anim.start( PieAnimationDriver::Rects );
+}
+
+QList< PieQuad > QPieMenu::zoomZiele( int id ) const
+{
+	// Gerechnet wird auf einer Kopie der Elemente: stepBox() liest nur Größen und Ruhewinkel und
+	// schreibt die Ziele hinein.  Die Animation in _data läuft derweil unberührt weiter.
+	SuperPolator d;
+	static_cast< QList< SPElem > & >( d ) = _data;
+	d.setR( _data.r() );
+	for ( auto &i : d ) i.ziel() = { qQNaN(), qQNaN(), qQNaN(), qQNaN() };
+	int ac = d.count(), ip = id + 1, im = id - 1;
+	// ich möchte das Element id auf Skalierungsfaktor 1.5 fahren und alle anderen Boxen
 	// ausweichen lassen - bisher scheint das leider nicht richtig zu funktionieren, vermutlich wird
 	// zum Ausweichen doch mehr Radius gebraucht.
-	_data[ _folgeId ].ziel() = _mm256_setr_pd( _data.r(), _data[ _folgeId ].a, 1., SCALE_MAX );
-	auto t01				 = _mm_setr_pd( 0., 1. );
-	_data[ _folgeId ].t01()	 = t01;
-	QRectF rwsd0{ _data.r(), _data[ _folgeId ].a, 1., _initData.dir() }, rwsd{ rwsd0 }, nr;
-	QSizeF lstSz0{ QSizeF( _data[ _folgeId ] ) * SCALE_MAX }, lstSz{ lstSz0 };
-	qreal  delta;
+	d[ id ].ziel() = { d.r(), d[ id ].a, 1., SCALE_MAX };
+	QRectF			rwsd0{ d.r(), d[ id ].a, 1., _initData.dir() }, rwsd{ rwsd0 };
+	QSizeF			lstSz0{ QSizeF( d[ id ] ) * SCALE_MAX }, lstSz{ lstSz0 };
+	PieLayoutSolver s{ d, _initData, _styleData.sp, _avgSz };
 
 	// In dieser Situation ist die Ruhedatenberechnung längst passiert und die Boxen sind alle
 	// sichtbar auf dem Bildschirm.  Daher kann ich auf mehrere Prüfungen verzichten:
@@ -695,23 +1185,17 @@ void QPieMenu::createZoom()
 	//  nur für diese Elemente etwas vergrößern - ist aber leider nicht mit der Datenstruktur
 	//  abbildbar, da ich die Radien für die Elemente nur animiere, aber nicht extra Standardwerte
 	//  speichere.
-	while ( ip < ac )
-	{
-		delta				= stepBox( ip, rwsd, lstSz );
-		_data[ ip++ ].t01() = t01;
-	}
+	while ( ip < ac ) s.stepBox( ip++, rwsd, lstSz );
 	rwsd = rwsd0, lstSz = lstSz0;
 	rwsd.setHeight( _initData.dir( -1. ) );
-	while ( im >= 0 )
-	{
-		delta				= stepBox( im, rwsd, lstSz );
-		_data[ im-- ].t01() = t01;
-	}
-	_data.startAnimation( _initData._animBaseDur );
-	_rectsAnimiert.start( 10, this );
+	while ( im >= 0 ) s.stepBox( im--, rwsd, lstSz );
+	QList< PieQuad > ziele;
+	ziele.reserve( ac );
+	for ( const auto &i : std::as_const( d ) ) ziele.append( i.ziel() );
+	return ziele;
 }
 
-qreal QPieMenu::stepBox( int index, QRectF &rwsd, QSizeF &lastSz )
+qreal PieLayoutSolver::stepBox( int index, QRectF &rwsd, QSizeF &lastSz )
 {
 	// Ich berechne hier die nächste Box in die entsprechende Richtung.
 	BestDelta bd;
@@ -719,7 +1203,7 @@ qreal QPieMenu::stepBox( int index, QRectF &rwsd, QSizeF &lastSz )
 	bool	  needO	 = ( index < 0 || index >= _data.count() );
 	auto	  c		 = rwsd.x() * qSinCos( rwsd.y() );
 	auto	  ns	 = rwsd.width() * ( needO ? QSizeF{ 0., 0. } : QSizeF( _data[ index ] ) );
-	auto	  offset = ( fromSize( lastSz ) + fromSize( ns ) ) * 0.5 + asPointF( _styleData.sp );
+	auto	  offset = ( fromSize( lastSz ) + fromSize( ns ) ) * 0.5 + asPointF( _sp );
 	bd.init( rwsd.height(), rwsd.y() );
 	for ( auto i : { c + offset, c - offset } )
 	{
@@ -747,16 +1231,23 @@ void QPieMenu::makeZielStill( qreal r0 )
 	// Übertragen berechneter Animationszieldaten in die Still-Data
 	for ( auto &i : _data ) i.a = i.ea;
 	_data.setR( r0 );
+	buildWinkelIndex();
 	_boundingRect = QRectF{ { -r0, -r0 }, QPointF{ r0, r0 } }.toRect();
 	auto xa		  = _avgSz.width();	 //>> 1;
 	auto ya		  = _avgSz.height(); // >> 1;
 	_boundingRect.adjust( -xa, -ya, xa, ya );
+	// Vorab berechnete Zoom-Ziele gehören zum alten Layout
+	_vorZoom = {};
+	// Die Bedingungen der Zustandstabelle brauchen Totzone und Radius
+	SmData e;
+	e.minDm = totzone(), e.r0 = r0;
+	zustandsEvent( PieStateTable::initEvent, e );
 	updateGeometry();
 }
 
-void QPieMenu::showChild( int index )
+void QPieMenu::showChild( int index, QRect r )
 {
-	auto r	= _actionRects[ index ];
+	if ( r.isNull() ) r = _actionRects[ index ];
 	auto a	= actions().at( index );
 	auto pm = ( r.center() - _boundingRect.topLeft() + pos() /**/ );
 	qDebug() << "show child: p=" << r.center() << ", p_mapped=" << pm << ", myPos=" << pos()
@@ -792,9 +1283,10 @@ void QPieMenu::initVisible( bool show )
 		_data.initShowUp( _initData._animBaseDur,
 						  fromPar ? _initData._start0 + _initData.dir( 0.5 ) * _initData._max0
 								  : 0.f );
-		_rectsAnimiert.start( 10, this );
-		_selRect	  = { {}, _styleData.HLtransparent };
-		_selRectDirty = false;
+		_anim.start( PieAnimationDriver::Rects );
+		_selRect = { {}, _styleData.HLtransparent };
+		_anim.stop( PieAnimationDriver::SelRect );
+		_strich = false, _gezeigtNs = PieAnimationDriver::now();
 		setState( PieMenuStatus::still ); // Not calling makeState on Purpose!
 	} else {
 		// 2. Aufruf, nach der Anim ...
@@ -806,7 +1298,7 @@ void QPieMenu::initVisible( bool show )
 			QMenu::setVisible( false );
 		} else { // 1. Aufruf -> Anim starten, Zustand merken
 			_data.initHideAway( _initData._animBaseDur * 2, actionIndex( activeAction() ) );
-			_rectsAnimiert.start( 10, this );
+			_anim.start( PieAnimationDriver::Rects );
 			auto c = _styleData.HLtransparent;
 			if ( _state == PieMenuStatus::hover )
 				// Element wurde ausgewählt und aktiviert -> das selRect hat eine andere
@@ -825,9 +1317,8 @@ void QPieMenu::initStill()
 { // STILL-Zustand herstellen - sollte immer akzeptabel
   // sein.  Alle Elemente fahren auf ihren Ursprungszustand zurück.
 	_folgeId = _hoverId = -1;
-	_rectsAnimiert.stop();
 	_data.initStill( _initData._animBaseDur >> 1 );
-	_rectsAnimiert.start( 10, this );
+	_anim.start( PieAnimationDriver::Rects );
 	startSelRect( { 0, 0, -1, -1 } );
 	setState( PieMenuStatus::still );
 }
@@ -860,9 +1351,7 @@ void QPieMenu::initHover( int newHID )
 	  // Dummerweise muss die Position vom Ziel aus berechnet werden!
 		_folgeId = _hoverId = newHID;
 		createZoom();
-		auto r = QRect{ {}, SCALE_MAX * QSize( _data[ _hoverId ] ) };
-		r.moveCenter( ( _data.r() * qSinCos( _data[ _hoverId ].a ) ).toPoint() );
-		startSelRect( r );
+		startSelRect( zoomRect( _hoverId ) );
 		if ( !sub ) // nicht schon aktiv?
 		{
 			// Und QMenu / die QActions brauchen noch
@@ -872,6 +1361,8 @@ void QPieMenu::initHover( int newHID )
 					emit QMenu::hovered( a );
 					a->activate( QAction::Hover );
 					_alertId = _hoverId, _alertTimer.start( _initData._subMenuDelayMS, this );
+					// Bis der Timer abläuft, ist das Layout des Submenüs längst gelöst
+					kindVorbereiten( _hoverId );
 				} else setActiveAction( a );
 			else _alertTimer.stop();
 		}
@@ -885,53 +1376,109 @@ void QPieMenu::initActive()
 	// Die _hoverId sollte vorab gesetzt werden.  Hier wird nur der Status durch das
 	// Selection Rect übernommen. Wenn der Timer für den Keyboard Override aktiv ist,
 	// war es eine Keyboard-Aktivierung.  Wenn nicht, ist der Submenu-Timer abgelaufen.
-	auto r = QRect{ {}, SCALE_MAX * QSize( _data[ _hoverId ] ) };
-	r.moveCenter( ( _data.r() * qSinCos( _data[ _hoverId ].a ) ).toPoint() );
+	// Das Submenü geht am Ziel des Zooms auf - so passen seine Vorgaben zu kindVorbereiten().
+	auto r = zoomRect( _hoverId );
 	startSelRect( r );
-	if ( !_kbdOvr.isActive() ) showChild( _hoverId );
+	if ( _kbdOvr.isActive() ) kindVorbereiten( _hoverId );
+	else showChild( _hoverId, r );
 	setState( PieMenuStatus::item_active );
 }
 
-void QPieMenu::updateCurrentVisuals()
+QRect QPieMenu::zoomRect( int index ) const
 {
-	if ( !_actionRectsDirty && !_selRectDirty ) return;
+	auto r = QRect{ {}, SCALE_MAX * QSize( _data[ index ] ) };
+	r.moveCenter( ( _data.r() * qSinCos( _data[ index ].a ) ).toPoint() );
+	return r;
+}
 
-	if ( _actionRectsDirty )
-		_data.update( _actionRects, _actionRenderData ), _actionRectsDirty = false;
-	if ( _selRectDirty )
-	{
-		if ( _selRectAnimiert.isActive() )
-		{
-			auto x =
-				smoothStep( static_cast< qreal >( _selRectStart.msecsTo( QTime::currentTime() ) )
-							/ _initData._animBaseDur );
-			_selRect( x, _srS, _srE );
-			if ( x >= 1. )
-			{
-				_selRectAnimiert.stop();
-				// qDebug() << "SRST0PP" << _selRect;
-			}
-		}
-		_selRectDirty = false;
-	}
+void QPieMenu::kindVorbereiten( int index )
+{
+	// Dieselben Vorgaben wie in showChild(), mit dem Rect aus zoomRect()
+	if ( auto cpm = qobject_cast< QPieMenu * >( actions().at( index )->menu() ) )
+		cpm->layoutVorbereiten( fromSize( zoomRect( index ).size() ).manhattanLength() * 1.2,
+								_data[ index ].a + M_2_SQRTPI, _data[ index ].a - M_2_SQRTPI );
+}
+
+void QPieMenu::updateCurrentVisuals()
+{
+	ensureLayout();
+	// Die laufenden Animationen schreibt animationFrame() weiter.  Hier geht es nur noch um Rects,
+	// die außerhalb einer Animation ungültig wurden (Actions geändert, neue Still-Daten).
+	if ( !_actionRectsDirty ) return;
+	auto now = _anim.isActive( PieAnimationDriver::Rects ) ? _anim.frameTime()
+														   : PieAnimationDriver::now();
+	_data.update( _actionRects, _actionRenderData, now ), _actionRectsDirty = false;
 }
 
-bool QPieMenu::hitTest( const QPoint &p, qreal &mindDistance, qint32 &minDistID )
+bool QPieMenu::hitTest( const QPoint &p, qreal &mindDistance, qint32 &minDistID, int around )
 {
-	int	 md = std::numeric_limits< int >::max(), d;
-	auto i( _actionRects.count() - 1 );
-	for ( ; i >= 0; --i )
-		if ( !actions().at( i )->isSeparator() )
+	int		   md = std::numeric_limits< int >::max(), d;
+	const auto n  = int( _winkelIndex.count() );
+	// In Ruhe liegt die nächste Box immer bei einem der Winkel-Nachbarn.  Während einer Animation
+	// passen die Ruhewinkel nicht zu den Boxen -> dann alle prüfen, gebündelt über die Hit-Lanes.
+	if ( around >= 0 && n > 2 * WINKEL_NACHBARN + 1
+		 && !_anim.isActive( PieAnimationDriver::Rects ) )
+		for ( int k = -WINKEL_NACHBARN; k <= WINKEL_NACHBARN; ++k )
 		{
-			d = boxDistance( p, _actionRects.at( i ) );
+			auto i = _winkelIndex[ ( around + k + n ) % n ].id;
+			d	   = boxDistance( p, _actionRects.at( i ) );
 			if ( d < md ) md = d, minDistID = i;
 		}
+	else if ( auto i = PieSimd::kernels().minBoxDistance( _data.hitRects(), PieRectLanes::SkipSep,
+														  p, &md );
+			  i >= 0 )
+		minDistID = i;
 	if ( Q_LIKELY( md < std::numeric_limits< int >::max() ) )
 		mindDistance = static_cast< qreal >( md );
-	else minDistID = i;
+	else minDistID = -1;
 	return md <= 0; // Hit bei Distance <= 0 ...
 }
 
+void QPieMenu::buildWinkelIndex()
+{
+	_winkelIndex.clear();
+	for ( int i = 0, c = _data.count(); i < c; ++i )
+		if ( auto act = actions().at( i ); !act->isSeparator() && act->isVisible() )
+		{
+			auto a = _data[ i ].a;
+			_winkelIndex.append( { a - 2 * M_PI * qFloor( a / ( 2 * M_PI ) ), a, i } );
+		}
+	std::sort( _winkelIndex.begin(), _winkelIndex.end(),
+			   []( const auto &l, const auto &r ) { return l.w < r.w; } );
+	// Nachbarn im Kreis: aufsteigender Winkel läuft auf dem Bildschirm gegen den Uhrzeigersinn
+	const auto n = int( _winkelIndex.count() );
+	_nachbarCw.fill( -1, _data.count() ), _nachbarCcw.fill( -1, _data.count() );
+	for ( int k = 0; k < n; ++k )
+	{
+		auto id			 = _winkelIndex[ k ].id;
+		_nachbarCcw[ id ] = _winkelIndex[ ( k + 1 ) % n ].id;
+		_nachbarCw[ id ]  = _winkelIndex[ ( k + n - 1 ) % n ].id;
+	}
+	// Nummernblock als Kompass: Richtung (dx, dy) in Bildschirm-Koordinaten je Taste 1..9
+	constexpr int dx[ 9 ] = { -1, 0, 1, -1, 0, 1, -1, 0, 1 };
+	constexpr int dy[ 9 ] = { 1, 1, 1, 0, 0, 0, -1, -1, -1 };
+	for ( int k = 0; k < 9; ++k )
+	{
+		auto pos	  = k == 4 ? -1 : winkelNaechster( qAtan2( dx[ k ], dy[ k ] ) );
+		_kompass[ k ] = pos < 0 ? -1 : _winkelIndex[ pos ].id;
+	}
+}
+
+int QPieMenu::winkelNaechster( qreal w ) const
+{
+	const auto n = int( _winkelIndex.count() );
+	if ( !n ) return -1;
+	auto wn = w - 2 * M_PI * qFloor( w / ( 2 * M_PI ) );
+	// Erster Eintrag >= wn und sein (zyklischer) Vorgänger sind die einzigen Kandidaten
+	auto it = std::lower_bound( _winkelIndex.cbegin(), _winkelIndex.cend(), wn,
+								[]( const auto &e, qreal v ) { return e.w < v; } );
+	int	 hi = int( it - _winkelIndex.cbegin() ) % n, lo = ( hi + n - 1 ) % n;
+	return qAbs( distance< M_PI >( w, _winkelIndex[ lo ].a ) )
+				   <= qAbs( distance< M_PI >( w, _winkelIndex[ hi ].a ) )
+			 ? lo
+			 : hi;
+}
+
 void QPieMenu::startSelRect( QRect tr )
 {
 	if ( !tr.isNull() ) // Ziel wird hier vorbereitet
@@ -941,8 +1488,10 @@ void QPieMenu::startSelRect( QRect tr )
 	}
 	// - nimm die letzte Position des SelRects as Startwert
 	_srS		  = _selRect;
-	_selRectStart = QTime::currentTime();
-	_selRectAnimiert.start( 10, this );
+	_selRectStart = PieAnimationDriver::now();
+	_anim.start( PieAnimationDriver::SelRect );
+	// Das bisher ausgewählte Element verliert seinen "Selected"-Zustand
+	update();
 }
 
 void QPieMenu::startSelRectColorFade( const QColor &target_color )
@@ -956,18 +1505,42 @@ void QPieMenu::showAsChild( QPieMenu *source, QPoint pos, qreal minRadius, qreal
 {
 	// Ein Versuch, das automatische oder (via Tasta) manuelle öffnen eines Submenüs, was auch ein
 	// QPieMenu ist, zu basteln ...
-	auto dl						 = endAngle - startAngle;
-	_initData._execPoint		 = pos;
-	_initData._minR				 = minRadius;
-	_initData._start0			 = startAngle;
-	_initData._max0				 = qAbs( dl );
-	_initData._negativeDirection = dl < 0.;
-	_causedMenu					 = source;
-	createStillData();
+	_initData			 = kindInitData( minRadius, startAngle, endAngle );
+	_initData._execPoint = pos;
+	// Ein Strich endet nicht am Submenü
+	_initData._strokeMode |= source && source->strokeMode();
+	_causedMenu			 = source;
+	if ( _layoutPending ) relayout();
+	else createStillData();
 	auto p = pos - QPointF{ _data.r(), _data.r() }.toPoint();
 	popup( p );
 }
 
+PieInitData QPieMenu::kindInitData( qreal minRadius, qreal startAngle, qreal endAngle ) const
+{
+	auto dl				 = endAngle - startAngle;
+	auto d				 = _initData;
+	d._minR				 = minRadius;
+	d._start0			 = startAngle;
+	d._max0				 = qAbs( dl );
+	d._negativeDirection = dl < 0.;
+	return d;
+}
+
+void QPieMenu::layoutVorbereiten( qreal minRadius, qreal startAngle, qreal endAngle )
+{
+	// Vermessen geht nur im GUI-Thread (Style, Fonts), dank metricsCache ist das aber billig.
+	// Gelöst wird im Worker-Thread auf einer Kopie der Größen - dem Schlüssel.  showAsChild()
+	// übernimmt dann in createStillData() nur noch das Ergebnis.
+	if ( isVisible() ) return;
+	// Die Größen gelten dann auch für showAsChild() - dort muss nicht noch einmal vermessen werden
+	if ( _layoutPending ) _layoutPending = false, _stillDirty = true, calculatePieDataSizes();
+	if ( _data.count() != actions().count() ) return;
+	auto key = layoutKey( kindInitData( minRadius, startAngle, endAngle ) );
+	if ( ( _vorLayout.isValid() && key == _vorKey ) || layoutCache().contains( key ) ) return;
+	_vorLayout = PieLayoutSolver::solveInBackground( _vorKey = key );
+}
+
 void QPieMenu::childHidden( QPieMenu *child, bool hasTriggered )
 {
 	qDebug() << "QPieMenu::childHidden" << hasTriggered;
@@ -975,9 +1548,8 @@ void QPieMenu::childHidden( QPieMenu *child, bool hasTriggered )
 	else initHover( actionIndex( child->menuAction() ) );
 }
 
-#pragma optimize( "t", on )
-inline PieSelectionRect &PieSelectionRect::operator()( const qreal f, const PieSelectionRect &a,
-													   const PieSelectionRect &b )
+PieSelectionRect &PieSelectionRect::operator()( const qreal f, const PieSelectionRect &a,
+												const PieSelectionRect &b )
 {
 	// We've reached the future some time ago?
 	// https://fgiesen.wordpress.com/2012/08/15/linear-interpolation-past-present-and-future/
@@ -992,34 +1564,146 @@ inline PieSelectionRect &PieSelectionRect::operator()( const qreal f, const PieS
 	//          fma( b, t, fnma( a, t, a ) ) -> this may be nicer to read ;)
 	//      And - "BTATA" - there you have the next gen lerp, as long as you make sure to
 	//      clamp t into [0.0 .. 1.0] !!!111!!11!!!1!!!
+	//      ... und genau so rechnen es die PieSimd-Kernels (ohne FMA eben ausgeschrieben).
 	// --------------------------------------------------------------------------------------
-	// SSE Shuffle-Maskem der RGBA-Werte aus QColor
-	const __m128i QCload  = _mm_set_epi64x( 0xffff0b0affff0908ull, 0xffff0706ffff0504ull );
-	const __m128i QCback  = _mm_set_epi64x( 0xffffffff0d0c0908ull, 0x05040100ffffffffull );
-	const __m128i QCstore = _mm_set_epi64x( 0x00000000ffffffffull, 0xffffffff00000000ull );
-
-	// Wir wissen, dass QRectF intern einfach 4 doubles abspeichert.  Die können wir ja direkt
-	// laden. Ebenso wissen wir, dass QColor eine 4-Bytes-Spec beinhaltet und darauf folgt ein
-	// ushort[5] Array mit den Farbdaten.  Können wir also alles stream-Laden.
-	auto		  t		  = _mm256_set1_pd( f );
-	auto		  r0	  = _mm256_load_pd( reinterpret_cast< const qreal * >( &a ) );
-	auto		  cc0	  = _mm_load_si128( reinterpret_cast< const __m128i * >( &a ) + 2 );
-	auto		  r1	  = _mm256_load_pd( reinterpret_cast< const qreal * >( &b ) );
-	auto		  cc1	  = _mm_load_si128( reinterpret_cast< const __m128i * >( &b ) + 2 );
-	// Maybe a manual split-up of operations increases parallelity
-	auto		  c0	  = _mm256_cvtepi32_pd( _mm_shuffle_epi8( cc0, QCload ) );
-	auto		  c1	  = _mm256_cvtepi32_pd( _mm_shuffle_epi8( cc1, QCload ) );
-	// -> directly store it in here
-	_mm256_store_pd( reinterpret_cast< qreal * >( &first ),
-					 /* Lerp the QRectF*/ _mm256_fmadd_pd( r1, t, _mm256_fnmadd_pd( r0, t, r0 ) ) );
-	_mm_maskstore_epi32( reinterpret_cast< int * >( &second ), QCstore,
-						 /*Lerp the colors*/
-						 _mm_shuffle_epi8( _mm256_cvtpd_epi32( _mm256_fmadd_pd(
-											   c1, t, _mm256_fnmadd_pd( c0, t, c0 ) ) ),
-										   QCback ) );
+	// Wir wissen, dass QRectF intern einfach 4 doubles abspeichert.  Die gehen direkt in den
+	// Kernel.  Die Farbe hole ich mir nicht mehr aus dem QColor-Inneren, sondern als QRgba64 - das
+	// ist offizielle API und liefert ebenfalls 16 Bit je Kanal.
+	const auto &k = PieSimd::kernels();
+	k.lerp4( f, reinterpret_cast< const qreal * >( &a.first ),
+			 reinterpret_cast< const qreal * >( &b.first ), reinterpret_cast< qreal * >( &first ) );
+	second = QColor::fromRgba64(
+		QRgba64::fromRgba64( k.lerpRgba64( a.second.rgba64(), b.second.rgba64(), f ) ) );
 	return *this;
 }
-#pragma optimize( "", on )
+
+// PieAnimationDriver
+PieAnimationDriver::PieAnimationDriver( QWidget *w, std::function< QRegion( qint64 ) > onFrame )
+	: _w( w )
+	, _onFrame( std::move( onFrame ) )
+{}
+
+PieAnimationDriver::~PieAnimationDriver()
+{
+	// Auch gestoppte Driver können bis zum nächsten Frame noch in der Liste stehen.  Ist der
+	// Scheduler schon mit qApp abgebaut, gibt es keine Liste mehr - neu anlegen wäre falsch.
+	if ( auto s = PieAnimationScheduler::existing() ) s->remove( this );
+}
+
+qint64 PieAnimationDriver::now()
+{
+	// Ein Zeitgeber für alle Menüs - damit sind auch die Zeitstempel verschiedener Menüs
+	// vergleichbar.  QElapsedTimer ist monoton, Uhrumstellungen stören also nicht.
+	static const QElapsedTimer et = [] {
+		QElapsedTimer t;
+		t.start();
+		return t;
+	}();
+	return et.nsecsElapsed();
+}
+
+qint64 PieAnimationDriver::frameTime() const
+{
+	auto s = PieAnimationScheduler::existing();
+	return s ? s->frameTime() : 0;
+}
+
+void PieAnimationDriver::start( Kanal k )
+{
+	_aktiv |= k;
+	PieAnimationScheduler::instance().add( this );
+}
+
+// PieAnimationScheduler
+static QPointer< PieAnimationScheduler > &schedulerZeiger()
+{
+	static QPointer< PieAnimationScheduler > s;
+	return s;
+}
+
+PieAnimationScheduler &PieAnimationScheduler::instance()
+{
+	// Hängt an qApp, damit er vor dem Event-Dispatcher abgebaut wird
+	auto &s = schedulerZeiger();
+	if ( !s ) s = new PieAnimationScheduler( qApp );
+	return *s;
+}
+
+PieAnimationScheduler *PieAnimationScheduler::existing()
+{
+	return schedulerZeiger();
+}
+
+void PieAnimationScheduler::add( PieAnimationDriver *d )
+{
+	if ( !_aktive.contains( d ) ) _aktive.append( d );
+	schedule();
+}
+
+void PieAnimationScheduler::remove( PieAnimationDriver *d )
+{
+	_aktive.removeOne( d );
+	// Lief der Takt über dieses Menü, muss ein anderes Fenster übernehmen
+	if ( _win && d->widget()->windowHandle() == _win )
+	{
+		_win->removeEventFilter( this ), _win = nullptr;
+		if ( _angefordert ) _angefordert = false, schedule();
+	}
+}
+
+void PieAnimationScheduler::schedule()
+{
+	if ( _angefordert || _aktive.isEmpty() ) return;
+	_angefordert = true;
+	// Getaktet wird über das Fenster eines animierten Menüs.  Ist das bisherige nicht mehr dabei
+	// (Menü fertig animiert, versteckt, QWindow neu erzeugt), wird der Filter umgehängt.
+	QWindow *w	 = nullptr;
+	for ( auto d : std::as_const( _aktive ) )
+		if ( auto dw = d->widget()->windowHandle(); dw && dw->isVisible() )
+		{
+			w = dw;
+			if ( dw == _win ) break;
+		}
+	if ( w != _win )
+	{
+		if ( _win ) _win->removeEventFilter( this );
+		if ( ( _win = w ) ) _win->installEventFilter( this );
+	}
+	// Mit Fenster läuft der Ersatztakt langsam als Wachhund mit: wird das Fenster versteckt oder
+	// verdeckt, bevor sein UpdateRequest kommt, hängt sonst jedes Menü an diesem einen Frame.
+	if ( _win ) _win->requestUpdate(), _ersatz.start( 100, this );
+	else _ersatz.start( 16, this );
+}
+
+void PieAnimationScheduler::frame()
+{
+	_angefordert = false;
+	_ersatz.stop();
+	_frame = PieAnimationDriver::now();
+	// Auf einer Kopie laufen: ein Schritt kann Menüs verstecken oder ganz abbauen, die sich dann
+	// selbst austragen.
+	const auto liste = _aktive;
+	for ( auto d : liste )
+		if ( _aktive.contains( d ) && d->isRunning() )
+			if ( auto r = d->_onFrame( _frame ); !r.isEmpty() ) d->widget()->update( r );
+	_aktive.removeIf( []( const PieAnimationDriver *d ) { return !d->isRunning(); } );
+	// Läuft noch etwas, wird der nächste Frame angefordert - sonst ist hier Schluss.
+	schedule();
+}
+
+bool PieAnimationScheduler::eventFilter( QObject *o, QEvent *e )
+{
+	// Nicht schlucken: das QWindow malt im selben Durchgang, was frame() per update() angefordert
+	// hat.
+	if ( o == _win && e->type() == QEvent::UpdateRequest && _angefordert ) frame();
+	return QObject::eventFilter( o, e );
+}
+
+void PieAnimationScheduler::timerEvent( QTimerEvent *e )
+{
+	if ( e->timerId() == _ersatz.timerId() ) frame();
+	else QObject::timerEvent( e );
+}
 
 /***************************************************************************************************
  * Der Super-polator. .. ... .. . Eigentlich nur eine einfache Listen-Interpolator-Klasse.
@@ -1042,68 +1726,22 @@ inline PieSelectionRect &PieSelectionRect::operator()( const qreal f, const PieS
  *  Programm erhalten haben. Wenn nicht, siehe <https://www.gnu.org/licenses/>.
  *************************************************************************************************/
 
-const __m256d _num0		= _mm256_setzero_pd();
-const __m256d _num1		= _mm256_set1_pd( 1.0 );
-const __m256d _num2		= _mm256_set1_pd( 2.0 );
-const __m256d _num3		= _mm256_set1_pd( 3.0 );
-const __m256d _num_2	= _mm256_set1_pd( 0.5 );
-const __m256d _numPI	= _mm256_set1_pd( M_PI );
-const __m256d _numPI_2	= _mm256_set1_pd( M_PI_2 );
-const __m256d _num2_PI	= _mm256_set1_pd( M_2_PI );
-const __m256d _num1_PI	= _mm256_set1_pd( M_1_PI );
-
-const __m128d _nums_0_1 = _mm_setr_pd( 0., 1. );
-
-// Ein (paar?) Helfer für AVX(2)
-template < int pos >
-__m256d _mm256_insert_sd( __m256d dst, qreal v )
-{
-	return _mm256_castsi256_pd( _mm256_insert_epi64(
-		_mm256_castpd_si256( dst ), *reinterpret_cast< long long * >( &v ), pos ) );
-}
-
-__m256d test( SPElem &e, qreal t )
-{
-	//================================================================
-	// super-smooth-step, broadcasted ...
-	// auto x	  = ( t - t01[ 0 ] ) / ( t01[ 1 ] - t01[ 0 ] );
-	// auto st	  = _mm256_set1_pd( x * x * ( 3 - 2 * x ) );
-	//
-	// Hier kommen meine speziellen Zugriffshelfer
-	// voll zum Zuge                                AVX:0, 1, 2, 3
-	auto t01   = _mm256_castpd128_pd256( e.t01() ); // t0, t1, ., .
-	// t01 extrahieren -> t0 muss an beide Stellen,
-	// t an 0, t1 an 1 (wo es von vorn herein ist)
-	auto t0	   = _mm256_permute_pd( t01, 0 );	  // t0, t0, t0, t0
-	auto t1	   = _mm256_insert_sd< 0 >( t01, t ); // t , t1, . , .
-	// Differenzen bilden und den Divisor zurecht rücken
-	auto tt01n = _mm256_sub_pd( t1, t0 );			 // t-t0, t1-t0, ., .
-	auto tt01d = _mm256_permute_pd( tt01n, 0b0001 ); // t1-t0, t-t0, t-t0, t-t0
-	// Division -> k erhalten (ich bekomme sogar gleichzeitig 1/k ;)
-	auto sstk  = _mm256_div_pd( tt01n, tt01d ); // k, 1/k, ., .
-	// das Resultat muss in den Wertebereich geclamped werden
-	sstk	   = _mm256_max_pd( _num0, _mm256_min_pd( _num1, sstk ) );
-	// Schlussendlich die Kubische Funktion ausrechnen...
-	auto ssts =
-		_mm256_mul_pd( _mm256_mul_pd( _mm256_fnmadd_pd( sstk, _num2, _num3 ), sstk ), sstk );
-	// und das Ergebnis im Register verteilen ...
-	return _mm256_permute4x64_pd( ssts, 0 );
-	// ... das war jetzt etwas sehr viel Code für so etwas simples wie eine SSt ...
-	//=============================================================================
-}
-
 void SuperPolator::clear( int reserveSize )
 {
 	QList::clear();
 	QList::reserve( reserveSize );
-	durMs = 0;
+	durMs	   = 0;
+	lanesNewer = false;
+	lanes.resize( 0 );
+	skipHit.clear(), skipDirty = true;
 }
 
-int SuperPolator::append( QSize elementSize )
+int SuperPolator::append( QSize elementSize, bool skip )
 {
 	auto index = count();
 	resize( index + 1 );
 	operator[]( index ) = elementSize;
+	skipHit.append( skip ), skipDirty = true;
 	return index;
 }
 
@@ -1122,19 +1760,18 @@ void SuperPolator::initShowUp( int duration_ms, qreal startO )
 	//  t0/t1 nach SST mit 0.3/0.3 -> muss auch für jedes i ausgerechnet werden
 	//  =>   t_0i = index * start_max / ( count - 1 ),
 	//  =>   t_1i = end_min + ( index + 1 ) * ( 1. - end_min ) / count
-	int	 i = 0, cnt = count();
-	auto startVals		= _mm256_setr_pd( 0., ( startO == 0.f ? first().a : startO ), 0., 0.5 );
-	auto endVals		= _mm256_setr_pd( r0, 0, 1., 1. );
-	auto ssst_start_max = 0.3, ssst_end_min = 0.3;
-	auto sst01 = _mm_setr_pd( 0., ( ( cnt - 1. ) * ssst_end_min + 1. ) / cnt );
-	auto sstO  = _mm_setr_pd( ssst_start_max / ( cnt - 1. ), ( 1. - ssst_end_min ) / cnt );
-
-	for ( ; i < cnt; ++i, sst01 = _mm_add_pd( sst01, sstO ) )
+	int		i = 0, cnt = count();
+	PieQuad startVals{ 0., ( startO == 0.f ? first().a : startO ), 0., 0.5 };
+	auto	ssst_start_max = 0.3, ssst_end_min = 0.3;
+	qreal	sst0 = 0., sst1 = ( ( cnt - 1. ) * ssst_end_min + 1. ) / cnt;
+	qreal	sstO0 = ssst_start_max / ( cnt - 1. ), sstO1 = ( 1. - ssst_end_min ) / cnt;
+
+	for ( ; i < cnt; ++i, sst0 += sstO0, sst1 += sstO1 )
 	{
 		auto &ii	= operator[]( i );
 		ii.quelle() = startVals;
-		ii.ziel()	= _mm256_insert_sd< 1 >( endVals, ii.a );
-		ii.t01()	= sst01;
+		ii.ziel()	= { r0, ii.a, 1., 1. };
+		ii.setT( sst0, sst1 );
 	}
 	// das sollte es schon gewesen sein.
 	startAnimation( duration_ms );
@@ -1162,25 +1799,23 @@ void SuperPolator::initHideAway( int duration_ms, int ai )
 	// ... hmm, klingt gar nicht so schwierig ...
 
 	// korrigiere das aktuelle item, nachdem wir das "Abbiegen oder nicht" festgelegt haben
+	pullCurrent();
 	ai			 = ( ai >= 0 ? ai < cnt ? ai : cnt - 1 : qAbs( ai ) - 1 );
 	auto nu		 = qMax( ai, cnt - ai );
-	auto sst01	 = _mm_setr_pd( ai * ssst_start_max / ( nu - 1. ),
-								( ai + 1 ) * ( 1. - ssst_end_min ) / nu + ssst_end_min );
-	auto sstO	 = _mm_setr_pd( ssst_start_max / ( 1. - nu ), ( 1. - ssst_end_min ) / ( -nu ) );
-	auto aai	 = at( ai ).a;
-	auto endVals = _mm256_setr_pd( 0, aai, 0, 0.5 );
+	qreal sst0	= ai * ssst_start_max / ( nu - 1. );
+	qreal sst1	= ( ai + 1 ) * ( 1. - ssst_end_min ) / nu + ssst_end_min;
+	qreal sstO0 = ssst_start_max / ( 1. - nu ), sstO1 = ( 1. - ssst_end_min ) / ( -nu );
+	auto  aai	= at( ai ).a;
 
-	for ( ; i < cnt; ++i, sst01 = _mm_add_pd( sst01, sstO ) )
+	for ( ; i < cnt; ++i, sst0 += sstO0, sst1 += sstO1 )
 	{
 		auto &ii	= operator[]( i );
-		auto  z		= ( i == ai || ai < 0 )
-						  ? endVals
-						  : _mm256_insert_sd< 1 >( endVals,
-												   ( ii.a < aai ? aai - schlucki : aai + schlucki ) );
+		auto  za	= ( i == ai || ai < 0 ) ? aai
+											: ( ii.a < aai ? aai - schlucki : aai + schlucki );
 		ii.quelle() = ii.aktuell();
-		ii.ziel()	= z;
-		ii.t01()	= sst01;
-		if ( i == ai ) sstO = _mm_xor_pd( sstO, _mm_set1_pd( -0.0 ) );
+		ii.ziel()	= { 0., za, 0., 0.5 };
+		ii.setT( sst0, sst1 );
+		if ( i == ai ) sstO0 = -sstO0, sstO1 = -sstO1;
 	}
 	// das sollte es schon gewesen sein.
 	startAnimation( duration_ms );
@@ -1189,62 +1824,138 @@ void SuperPolator::initHideAway( int duration_ms, int ai )
 
 void SuperPolator::initStill( int duration_ms )
 {
-	int	 i = 0, cnt = count();
-	auto endVals		= _mm256_setr_pd( r0, 0, 1., 1. );
-	auto ssst_start_max = 0.3, ssst_end_min = 0.3;
-	auto sst01 = _mm_setr_pd( 0., ( ( cnt - 1. ) * ssst_end_min + 1. ) / cnt );
-	auto sstO  = _mm_setr_pd( ssst_start_max / ( cnt - 1. ), ( 1. - ssst_end_min ) / cnt );
+	int i = 0, cnt = count();
 
+	pullCurrent();
 	for ( ; i < cnt; ++i )
 	{
 		auto &ii	= operator[]( i );
 		ii.quelle() = ii.aktuell();
-		ii.ziel()	= _mm256_insert_sd< 1 >( endVals, ii.a );
-		ii.t01()	= _nums_0_1;
+		ii.ziel()	= { r0, ii.a, 1., 1. };
+		ii.setT( 0., 1. );
 	}
 	// das sollte es schon gewesen sein.
 	startAnimation( duration_ms );
 	debugInitialValues( "make_still" );
 }
 
-#ifndef __AVX2__
-#	pragma message( "AVX2 nicht definiert - geht es trotzdem?" )
-#endif // __AVX2__
+void SuperPolator::startAnimation( int ms )
+{
+	durMs = ms, started = PieAnimationDriver::now();
+	if ( mode == Storage::SoA ) pushLanes();
+}
+
+void SuperPolator::setStorage( Storage s )
+{
+	if ( s == mode ) return;
+	pullCurrent();
+	mode = s;
+	if ( mode == Storage::SoA ) pushLanes();
+}
 
-bool SuperPolator::update( QList< QRect > &actions, QList< QPointF > &opaScale )
+void SuperPolator::pushLanes()
 {
-	auto	ms = started.msecsTo( QTime::currentTime() );
-	auto	t  = qMin( ( qreal ) ms / durMs, 1. );
-	__m256d sst;
+	// AoS -> SoA: alles, was die Interpolation braucht, in die Lanes transponieren.  Das passiert
+	// nur beim Start einer Animation, der Aufwand ist also gegenüber update() vernachlässigbar.
+	static const SPElem pad{ 0, 0 };
+	lanes.resize( count() );
+	for ( int i = 0; i < lanes.stride; ++i )
+	{
+		const auto &e = i < lanes.count ? at( i ) : pad;
+		lanes[ SPLanes::W ][ i ]  = e.w;
+		lanes[ SPLanes::H ][ i ]  = e.h;
+		lanes[ SPLanes::T0 ][ i ] = e.t0;
+		lanes[ SPLanes::T1 ][ i ] = e.t1;
+		for ( int k = 0; k < 4; ++k )
+		{
+			lanes[ SPLanes::Lane( SPLanes::QR + k ) ][ i ] = ( &e.sr )[ k ];
+			lanes[ SPLanes::Lane( SPLanes::ZR + k ) ][ i ] = ( &e.er )[ k ];
+			lanes[ SPLanes::Lane( SPLanes::CR + k ) ][ i ] = ( &e.cr )[ k ];
+		}
+	}
+	lanesNewer = false;
+}
+
+void SuperPolator::pullCurrent()
+{
+	// SoA -> AoS, aber nur die aktuellen Werte - der Rest ist in den SPElem ohnehin "führend".
+	if ( !lanesNewer ) return;
+	for ( int i = 0, c = qMin( count(), lanes.count ); i < c; ++i )
+	{
+		auto &e = operator[]( i );
+		for ( int k = 0; k < 4; ++k )
+			( &e.cr )[ k ] = lanes[ SPLanes::Lane( SPLanes::CR + k ) ][ i ];
+	}
+	lanesNewer = false;
+}
+
+bool SuperPolator::update( QList< QRect > &actions, QList< QPointF > &opaScale, qint64 now,
+						   QList< QRect > *damage )
+{
+	auto t = qMin( qreal( now - started ) / ( 1e6 * durMs ), 1. );
+	if ( damage )
+	{
+		// Vorher-Stand merken - elementweise kopiert, damit "actions" nicht detached
+		prevRects.resize( count() ), prevOS.resize( count() );
+		std::copy_n( actions.cbegin(), count(), prevRects.begin() );
+		std::copy_n( opaScale.cbegin(), count(), prevOS.begin() );
+	}
+	if ( mode == Storage::SoA )
+	{
+		if ( lanes.count != count() ) pushLanes();
+		PieSimd::kernels().interpolate( lanes, t, actions.data(), opaScale.data() );
+		lanesNewer = true;
+	} else interpolateAoS( t, actions, opaScale );
+	if ( damage )
+		for ( int i = 0, c = count(); i < c; ++i )
+			if ( actions.at( i ) != prevRects.at( i ) || opaScale.at( i ) != prevOS.at( i ) )
+				damage->append( prevRects.at( i ) ), damage->append( actions.at( i ) );
+	syncHitRects( actions );
+	// Return true if animation is over.
+	return ( t >= 1. );
+}
+
+void SuperPolator::syncHitRects( const QList< QRect > &actions )
+{
+	const auto c = int( count() );
+	if ( hit.count != c || skipDirty )
+	{
+		hit.resize( c );
+		for ( int i = 0; i < c; ++i ) hit.setSeparator( i, skipHit.at( i ) );
+		skipDirty = false;
+	}
+	for ( int i = 0; i < c; ++i ) hit.set( i, actions.at( i ) );
+}
+
+void SuperPolator::interpolateAoS( qreal t, QList< QRect > &actions, QList< QPointF > &opaScale )
+{
+	const auto &k = PieSimd::kernels();
 	// auto	dbg = qDebug() << "update @ t=" << t << ":";
 	for ( int cnt = count(), i = 0; i < cnt; ++i )
 	{
 		auto &ii = operator[]( i );
 		// x(t) Super-Smoothstep mit den gespeicherten Parametern ...
-		auto  x	 = qMax( 0., qMin( 1., ( t - ii.t0 ) / ( ii.t1 - ii.t0 ) ) );
-		sst		 = _mm256_set1_pd( x * x * ( -2. * x + 3. ) );
+		auto  x	  = qMax( 0., qMin( 1., ( t - ii.t0 ) / ( ii.t1 - ii.t0 ) ) );
+		auto  sst = x * x * ( -2. * x + 3. );
 
 		// Interpolation
-		auto &cv = ii.aktuell();
-		cv = _mm256_fmadd_pd( ii.ziel(), sst, _mm256_fnmadd_pd( ii.quelle(), sst, ii.quelle() ) );
+		auto &cv  = ii.aktuell();
+		k.lerp4( sst, ii.quelle().data(), ii.ziel().data(), cv.data() );
 
-		// 128Bit - Zuweisung für Opacity und Scale ...
-		auto &os = reinterpret_cast< __m128d & >( opaScale[ i ] );
-		os		 = _mm256_extractf128_pd( cv, 1 );
+		// Opacity und Scale ...
+		opaScale[ i ] = { cv.o, cv.s };
 		// Box berechnen
-		auto &a	 = actions[ i ];
-		a.setSize( ( os.m128d_f64[ 1 ] * QSizeF( ii ) ).toSize() );
-		a.moveCenter( ( cv.m256d_f64[ 0 ] * qSinCos( cv.m256d_f64[ 1 ] ) ).toPoint() );
-		// dbg.nospace() << "\n\t" << i << ": sst =" << sst.m256d_f64[ 0 ] << ", cur =" <<
-		// ii.aktuell()
-		//			  << ", produces box: " << a << os;
+		auto &a		  = actions[ i ];
+		a.setSize( ( cv.s * QSizeF( ii ) ).toSize() );
+		a.moveCenter( ( cv.r * qSinCos( cv.a ) ).toPoint() );
+		// dbg.nospace() << "\n\t" << i << ": sst =" << sst << ", cur =" << ii.aktuell()
+		//			  << ", produces box: " << a << opaScale[ i ];
 	}
-	// Return true if animation is over.
-	return ( ms >= durMs );
 }
 
 QDebug SuperPolator::debug()
 {
+	pullCurrent();
 	auto d = qDebug() << "PieData: r0 =" << r() << "Duration" << durMs << "ms, started" << started;
 	for ( int i( 0 ), ic( count() ); i < ic; ++i )
 		d << "\n\t" << qSetFieldWidth( 2 ) << i << "anim:" << operator[]( i ).quelle() << "->"
@@ -21,9 +21,19 @@
  *****************************************************************************/
 #pragma once
 
+#include "PieStateTable.h"
+#include "intersector.h"
+#include "pielatency.h"
+#include "piesimd.h"
+
 #include <QBasicTimer>
+#include <QCache>
+#include <QElapsedTimer>
+#include <QFuture>
+#include <QKeySequence>
 #include <QMenu>
-#include <QTime>
+#include <QPointer>
+#include <functional>
 
 #define SCALE_MAX 1.35
 
@@ -60,6 +70,8 @@ struct PieInitData
 	qreal	_start0{ qDegreesToRadians( 175 ) }, _max0{ qDegreesToRadians( 285 ) }, _minR{ 0. };
 	qreal	_selRectAlpha{ 0.5 };
 	quint32 _animBaseDur{ 250 }, _subMenuDelayMS{ 750 };
+	quint32 _predictMs{ 40 }; // Hover-Vorhersage: so weit wird der Zeiger extrapoliert, 0 = aus
+	bool	_strokeMode{ false }; // Marking-Menü: Auswahl per Strich mit gedrückter Taste
 	bool	_negativeDirection{ true }, _isContext{ true }, _isSubMenu{ false };
 
 	void	init( QPoint menuExecPoint, bool isContextMenu = true )
@@ -99,22 +111,20 @@ struct alignas( 128 ) SPElem
 	constexpr void operator=( const qreal o ) { a = o; }
 	constexpr	   operator QSize() const { return { w, h }; }
 	constexpr	   operator QSizeF() const { return { ( qreal ) w, ( qreal ) h }; }
-	__m128d		  &t01() { return *( &as128d() + 1 ); }
-	__m128d		  &as128d() { return *reinterpret_cast< __m128d * >( this ); }
-	__m256d		  &stillData() { return *reinterpret_cast< __m256d * >( this ); }
-	__m256d		  &quelle() { return *( reinterpret_cast< __m256d * >( this ) + 1 ); }
-	__m256d		  &ziel() { return *( reinterpret_cast< __m256d * >( this ) + 2 ); }
-	__m256d		  &aktuell() { return *( reinterpret_cast< __m256d * >( this ) + 3 ); }
-	const __m256d &quelle() const { return *( reinterpret_cast< const __m256d * >( this ) + 1 ); }
-	const __m256d &ziel() const { return *( reinterpret_cast< const __m256d * >( this ) + 2 ); }
-	const __m256d &aktuell() const { return *( reinterpret_cast< const __m256d * >( this ) + 3 ); }
+	void		   setT( qreal t_0, qreal t_1 ) { t0 = t_0, t1 = t_1; }
+	PieQuad		  &quelle() { return reinterpret_cast< PieQuad & >( sr ); }
+	PieQuad		  &ziel() { return reinterpret_cast< PieQuad & >( er ); }
+	PieQuad		  &aktuell() { return reinterpret_cast< PieQuad & >( cr ); }
+	const PieQuad &quelle() const { return reinterpret_cast< const PieQuad & >( sr ); }
+	const PieQuad &ziel() const { return reinterpret_cast< const PieQuad & >( er ); }
+	const PieQuad &aktuell() const { return reinterpret_cast< const PieQuad & >( cr ); }
 };
 
-inline QDebug operator<<( QDebug d, const __m256d &o )
+inline QDebug operator<<( QDebug d, const PieQuad &o )
 {
 	QDebugStateSaver s( d );
-	d.nospace() << Qt::fixed << qSetRealNumberPrecision( 3 ) << "{ " << o.m256d_f64[ 0 ] << ", "
-				<< o.m256d_f64[ 1 ] << ", " << o.m256d_f64[ 2 ] << ", " << o.m256d_f64[ 3 ] << " }";
+	d.nospace() << Qt::fixed << qSetRealNumberPrecision( 3 ) << "{ " << o.r << ", " << o.a << ", "
+				<< o.o << ", " << o.s << " }";
 	return d;
 }
 
@@ -212,7 +222,8 @@ class SuperPolator : public QList< SPElem >
 	void				 clear( int reserveSize );
 	constexpr void		 setR( qreal r ) { r0 = r; }
 	constexpr qreal		 r() const { return r0; }
-	int					 append( QSize elementSize );
+	// Separatoren ("skip") bekommen ein Rect, werden vom Hit-Test aber übergangen
+	int					 append( QSize elementSize, bool skip = false );
 	void				 setAngle( int index, qreal radians );
 
 	// Animationen müssen gut vorbereitet werden.  Vermutlich macht es am meisten Sinn, für jede
@@ -225,109 +236,58 @@ class SuperPolator : public QList< SPElem >
 	// Und nun zur Interpolation ...
 	// -> Im SuperPolator erstelle ich die aktuellen actionRects und renderDaten
 	// Die Funktion gibt "true" zurück, wenn seine interne Animation abgeschlossen ist.
-	bool				 update( QList< QRect > &actions, QList< QPointF > &opaScale );
-	void				 startAnimation( int ms ) { durMs = ms, started = QTime::currentTime(); }
+	// "now" ist die Bildzeit des PieAnimationDriver (ns), damit alle Animationen eines Frames mit
+	// demselben Zeitstempel rechnen.  Mit "damage" werden alter und neuer Rect jedes Elements, das
+	// sich verändert hat (Box, Deckkraft oder Skalierung), dort angehängt.
+	bool				 update( QList< QRect > &actions, QList< QPointF > &opaScale, qint64 now,
+								 QList< QRect > *damage = nullptr );
+	void				 startAnimation( int ms );
 
 	void				 copyCurrent2Source()
 	{
+		pullCurrent();
 		for ( auto &i : *this ) i.quelle() = i.aktuell();
 	}
 	QDebug debug();
 
+	// Ablage der Animationsdaten während der Interpolation:
+	//  -   AoS: update() läuft wie gehabt Element für Element über die 128-Byte-Blöcke.
+	//  -   SoA: startAnimation() überträgt Quelle, Ziel, t0/t1 und Größe in die SPLanes.
+	//           update() rechnet dann mit dem zur Laufzeit gewählten PieSimd-Kernel 2 bis 8
+	//           Elemente (Smoothstep, Lerp, Polar->Kartesisch) auf einmal.
+	//           Die aktuellen Werte landen nur in den Lanes und werden erst dann in die SPElem
+	//           zurückgeschrieben, wenn sie jemand braucht (pullCurrent()).
+	enum class Storage { AoS, SoA };
+	void				 setStorage( Storage s );
+	constexpr Storage	 storage() const { return mode; }
+
+	// Die Rects vom letzten update() als int32-Lanes für PieSimd::Kernels::minBoxDistance
+	const PieRectLanes	&hitRects() const { return hit; }
+	// AoS-Weg von update(): Element für Element über die 128-Byte-Blöcke, mit QRect-Methoden.
+	// Öffentlich, weil die Benchmarks die Kernels pixelgenau dagegen prüfen.
+	void				 interpolateAoS( qreal t, QList< QRect > &actions,
+										 QList< QPointF > &opaScale );
+
   private:
 	// Init-Helfer - wird fast überall benötigt und ist dank "Zugriffshelfer" inlinebar ;)
-	void  debugInitialValues( const char *dsc ) const;
+	void	debugInitialValues( const char *dsc ) const;
+	// SoA-Helfer
+	void	pushLanes();
+	void	pullCurrent();
+	void	syncHitRects( const QList< QRect > &actions );
 
 	// Variablen...
-	qreal r0{ 1. };		// der globale "Ruhe-Radius"
-	QTime started;		// falls gerade animiert wird, ist dies die gültige Startzeit
-	int	  durMs{ 100 }; // und dies hier wird die geplante Dauer der Animation sein.
-};
-
-// Der Intersektor ist eine Rect(F)-Liste, die beim Hinzufügen mit den "neuen Funktionen"
-// (add(),addAnyhow()...) auch einen Überlappungsstatus der hinzugefügten Rects speichert.
-template < typename R, typename P >
-	requires( std::is_same_v< R, QRect > && std::is_same_v< P, QPoint > )
-			|| ( std::is_same_v< R, QRectF > && std::is_same_v< P, QPointF > )
-struct Intersector : public QList< R >
-{
-	using R_type = R;
-	using P_type = P;
-
-	R	 _lastIntersection, _br;
-	bool _hasIntersection{ false };
-	// overwrite QList::clear()
-	void clear() { _br = {}, resetIntersection(), QList< R >::clear(); }
-	void resetIntersection() { _lastIntersection = {}, _hasIntersection = false; }
-	bool checkIntersections()
-	{
-		int i( QList< R >::count() - 1 );
-		while ( i > 0 )
-		{
-			auto j( i - 1 );
-			while ( j >= 0 )
-			{
-				if ( QList< R >::at( i ).intersects( QList< R >::at( j ) ) )
-				{
-					_lastIntersection = QList< R >::at( i ).intersected( QList< R >::at( j ) );
-					return ( _hasIntersection = true );
-				}
-				--j;
-			}
-			--i;
-		}
-		_lastIntersection = {};
-		return ( _hasIntersection = false );
-	}
-	// add() returns true, if the item can be added without intersections.
-	// If there is an intersection, lastIntersection will be set to the intersection rectangle and
-	// the item is not added.
-	virtual bool add( R_type r )
-	{
-		for ( auto i : *this )
-			if ( ( _lastIntersection = r.intersected( i ) ).isValid() )
-				return !( _hasIntersection = true );
-		QList< R >::append( r );
-		_br |= r;
-		return true;
-	}
-	virtual void addAnyhow( R_type r )
-	{
-		int i( QList< R >::count() );
-		while ( !_hasIntersection && ( --i >= 0 ) )
-			_hasIntersection =
-				( _lastIntersection = r.intersected( QList< R >::at( i ) ) ).isValid();
-		QList< R >::append( r );
-		_br |= r;
-	}
-	// changeItem() returns true, if the item at index can be changed without intersections.
-	virtual bool changeItem( int index, R_type newValue )
-	{
-		if ( QList< R >::at( index ) != newValue )
-		{
-			// assign and recheck bounds
-			QList< R >::operator[]( index ) = newValue;
-			int i( QList< R >::count() );
-			while ( !_hasIntersection && ( --i >= 0 ) )
-				if ( i != index )
-					_hasIntersection =
-						( _lastIntersection = newValue.intersected( QList< R >::at( i ) ) )
-							.isValid();
-			_br |= newValue;
-		}
-		return !_hasIntersection;
-	}
-	virtual bool changeItem( int index, P_type newCenter )
-	{
-		return changeItem( index, QList< R >::at( index ).translated(
-									  newCenter - QList< R >::at( index ).center() ) );
-	}
-	virtual void resetToFirst()
-	{
-		QList< R >::resize( 1 );
-		_br = QList< R >::first();
-		resetIntersection();
-	}
+	qreal	r0{ 1. };		// der globale "Ruhe-Radius"
+	qint64	started{ 0 };	// falls gerade animiert wird, ist dies die gültige Startzeit (ns)
+	int		durMs{ 100 };	// und dies hier wird die geplante Dauer der Animation sein.
+	SPLanes lanes;			// SoA-Spiegel für die gebündelte Interpolation
+	QList< QRect >	 prevRects; // Stand vor update() - nur für die Damage-Berechnung
+	QList< QPointF > prevOS;
+	PieRectLanes	 hit;		 // Hit-Test-Spiegel der Rects, siehe hitRects()
+	QList< bool >	 skipHit;	 // je Element: vom Hit-Test übergehen (Separator)
+	Storage			 mode{ Storage::SoA };
+	bool			 lanesNewer{ false }; // Lanes enthalten aktuellere "aktuell"-Werte als SPElem
+	bool			 skipDirty{ false };  // skipHit geändert seit dem letzten syncHitRects()
 };
 
 // Mal ein Versuch, die Winkeldifferenzen-Geschichte aus Strategie 3 zu vereinfachen:
@@ -338,13 +298,13 @@ class BestDelta
 	BestDelta( bool negAngles )
 		: dir( negAngles ? -1 : 1 )
 	{}
-	__forceinline void init( qreal direction, qreal reference_angle )
+	Q_ALWAYS_INLINE void init( qreal direction, qreal reference_angle )
 	{
 		bad = -( good = std::numeric_limits< qreal >::max() );
 		dir = direction;
 		w0	= reference_angle;
 	}
-	__forceinline void init( qreal reference_angle )
+	Q_ALWAYS_INLINE void init( qreal reference_angle )
 	{
 		bad = -( good = std::numeric_limits< qreal >::max() );
 		w0	= reference_angle;
@@ -354,26 +314,187 @@ class BestDelta
 	constexpr bool	hasBad() const { return bad > -std::numeric_limits< qreal >::max(); }
 	constexpr qreal best() const { return dir * ( hasGood() ? good : hasBad() ? bad : 0.0 ); }
 	template < double halfCircle >
-	__forceinline void addAngle( qreal a )
+	Q_ALWAYS_INLINE void addAngle( qreal a )
 	{
 		auto d = distance< halfCircle >( w0, a ) * dir;
 		if ( d > 0 ) good = qMin( good, d );
 		else if ( d < 0 ) bad = qMax( bad, d );
 	}
 	template < double halfCircle >
-	__forceinline void addBoth( qreal a, bool halfOffs )
+	Q_ALWAYS_INLINE void addBoth( qreal a, bool halfOffs )
 	{
 		addAngle< halfCircle >( a ), addAngle< halfCircle >( qreal( halfOffs ) * halfCircle - a );
 	}
 	// Instanziierungen für die beiden Winkelmaße:
-	__forceinline void addDeg( qreal a ) { addAngle< 180.0 >( a ); }
-	__forceinline void addRad( qreal a ) { addAngle< M_PI >( a ); }
-	__forceinline void addRad2( qreal a, bool isAsin = false ) { addBoth< M_PI >( a, isAsin ); }
+	Q_ALWAYS_INLINE void addDeg( qreal a ) { addAngle< 180.0 >( a ); }
+	Q_ALWAYS_INLINE void addRad( qreal a ) { addAngle< M_PI >( a ); }
+	Q_ALWAYS_INLINE void addRad2( qreal a, bool isAsin = false ) { addBoth< M_PI >( a, isAsin ); }
 
   private:
 	qreal good{ std::numeric_limits< qreal >::max() }, bad{ -std::numeric_limits< qreal >::max() },
 		dir{ -1 }, w0{ M_PI_2 };
 };
+
+// Schlüssel für den Cache fertig gerenderter Boxen: alles, was das Aussehen einer Box bestimmt,
+// aber nicht über ActionChanged/StyleChange gemeldet wird.
+struct PieItemKey
+{
+	const QAction *a;
+	int			   w, h;  // Grundgröße aus dem SuperPolator
+	int			   state; // Bits: Selected, Sunken, Enabled
+	int			   dpr;	  // devicePixelRatio * 100
+	int			   scale; // Skalierung * 16
+	bool		   operator==( const PieItemKey & ) const = default;
+};
+inline size_t qHash( const PieItemKey &k, size_t seed = 0 )
+{
+	return qHashMulti( seed, k.a, k.w, k.h, k.state, k.dpr, k.scale );
+}
+
+// Prozessweiter Cache für die Vermessung von Actions in calculatePieDataSizes().  Der Schlüssel
+// enthält alles, wovon Tabstopp-Breite und Inhaltsgröße abhängen - gleiche Actions in immer
+// wieder neu aufgebauten Menüs werden so nur einmal vermessen.
+struct PieMetricsKey
+{
+	const QStyle *style;
+	QString		  styleName; // falls die Adresse eines gelöschten Styles wiederverwendet wird
+	QFont		  menuFont, font;
+	QString		  text;
+	QKeySequence  shortcut;	 // leer, wenn nicht sichtbar
+	qint64		  icon;
+	int			  iconSize;
+	int			  flags; // Bits: checkable, exklusiv, Menü hat Checkables, Separator
+	bool		  operator==( const PieMetricsKey & ) const = default;
+};
+inline size_t qHash( const PieMetricsKey &k, size_t seed = 0 )
+{
+	return qHashMulti( seed, k.style, k.styleName, k.menuFont, k.font, k.text, k.shortcut, k.icon,
+					   k.iconSize, k.flags );
+}
+struct PieMetrics
+{
+	int	  tab{ 0 }; // Breite des Tabstopp-Teils (Text nach '\t' oder Shortcut)
+	QSize size;		// sizeFromContents( CT_MenuItem ), ohne Tabstopp
+};
+
+// Prozessweiter Cache für gelöste Ruhe-Layouts (createStillData).  Gleiche Boxgrößen unter
+// gleichen Winkel- und Abstandsvorgaben ergeben immer dasselbe Layout - das wiederholte Öffnen
+// eines Kontextmenüs kostet damit nur noch einen Lookup.
+struct PieLayoutKey
+{
+	QList< quint64 > sizes; // je Element ( w << 32 ) | h
+	qreal			 start0, max0, minR;
+	int				 sp;
+	bool			 negativeDirection, isSubMenu;
+	bool			 operator==( const PieLayoutKey & ) const = default;
+};
+inline size_t qHash( const PieLayoutKey &k, size_t seed = 0 )
+{
+	return qHashMulti( seed, k.sizes, k.start0, k.max0, k.minR, k.sp, k.negativeDirection,
+					   k.isSubMenu );
+}
+struct PieLayout
+{
+	qreal		   r;	   // Ruhe-Radius
+	QList< qreal > angles; // Ruhe-Winkel je Element
+};
+
+// Die Radiussuche für das Ruhe-Layout als reine Rechnung: Boxgrößen und Vorgaben rein, Zieldaten
+// (er, ea, es) raus.  Kein Widget, kein Style - mit einer eigenen Kopie der Größen (aus dem
+// PieLayoutKey) rechnet das auch ein Worker-Thread, z.B. für ein Submenü, über dem der Zeiger
+// gerade erst angekommen ist.
+class PieLayoutSolver
+{
+  public:
+	PieLayoutSolver( SuperPolator &data, const PieInitData &init, int sp, QSize avgSz )
+		: _data( data ), _init( init ), _sp( sp ), _avgSz( avgSz )
+	{}
+	// Kleiner Helfer: Radius der früheren linearen Suche in Runde "runde"
+	qreal						startR( int runde ) const;
+	// Kleinster passender Radius (auf 1 Pixel genau), die Zieldaten stammen von diesem Radius
+	qreal						solve( int *auswertungen = nullptr, int *runden = nullptr );
+	// Das Prädikat dazu: passen alle Boxen bei Radius r in den Winkelbereich, ohne sich zu
+	// überlappen?  Schreibt die Zieldaten für diesen Radius.
+	bool						stillFits( qreal r );
+	// Großer Helfer: berechne die nächste Box, gib das Delta zurück
+	qreal						stepBox( int index, QRectF &rwsd, QSizeF &lastSz );
+
+	// Nur aus dem Schlüssel - fasst kein QObject an und darf in jedem Thread laufen
+	static PieLayout			solve( const PieLayoutKey &k );
+	// Dasselbe im globalen QThreadPool
+	static QFuture< PieLayout > solveInBackground( PieLayoutKey k );
+
+  private:
+	SuperPolator	  &_data;
+	const PieInitData &_init;
+	int				   _sp;
+	QSize			   _avgSz;
+};
+
+// Animations-Anschluss eines Menüs.  Jedes Menü meldet hier seine laufenden Animationen als
+// Kanäle an, getaktet wird aber zentral vom PieAnimationScheduler: ein Frame, ein Zeitstempel
+// für alle offenen Menüs.  onFrame schreibt alle aktiven Kanäle weiter und gibt die Region
+// zurück, die sich am Bild geändert hat - nur die wird neu gezeichnet.
+class PieAnimationDriver
+{
+  public:
+	// Zeiger: gesammelte Mausbewegungen, die im nächsten Frame ausgewertet werden
+	enum Kanal : quint8 { Rects = 1, SelRect = 2, Zeiger = 4 };
+
+	PieAnimationDriver( QWidget *w, std::function< QRegion( qint64 ) > onFrame );
+	~PieAnimationDriver();
+	Q_DISABLE_COPY_MOVE( PieAnimationDriver )
+
+	// Monotone Zeit in ns - für das Starten von Animationen und als Bildzeit
+	static qint64  now();
+	qint64		   frameTime() const;
+
+	void		   start( Kanal k );
+	void		   stop( Kanal k ) { _aktiv &= ~k; }
+	constexpr bool isActive( Kanal k ) const { return _aktiv & k; }
+	constexpr bool isRunning() const { return _aktiv; }
+	QWidget		  *widget() const { return _w; }
+
+  private:
+	friend class PieAnimationScheduler;
+	QWidget							   *_w;
+	std::function< QRegion( qint64 ) > _onFrame;
+	quint8								_aktiv{ 0 };
+};
+
+// Der prozessweite Taktgeber.  Bei verschachtelten Pies liefen früher je Menü eigene Timer; jetzt
+// gibt es genau eine Frame-Anforderung per QWindow::requestUpdate() (in der Regel vsync) - auf dem
+// Fenster eines der animierten Menüs.  Ist kein Driver mehr aktiv, wird nichts mehr angefordert.
+class PieAnimationScheduler : public QObject
+{
+  public:
+	static PieAnimationScheduler &instance();
+	// Wie instance(), legt aber keinen an - nullptr vor dem ersten Start und nach dem Abbau mit
+	// qApp (Destruktoren beim Beenden)
+	static PieAnimationScheduler *existing();
+
+	void						  add( PieAnimationDriver *d );
+	void						  remove( PieAnimationDriver *d );
+	constexpr qint64			  frameTime() const { return _frame; }
+	qsizetype					  activeCount() const { return _aktive.count(); }
+
+  protected:
+	bool eventFilter( QObject *o, QEvent *e ) override;
+	// Ersatztakt, solange keines der Menüs ein sichtbares QWindow hat - sonst Wachhund, falls das
+	// UpdateRequest ausbleibt
+	void timerEvent( QTimerEvent *e ) override;
+
+  private:
+	using QObject::QObject;
+	void						  schedule();
+	void						  frame();
+
+	QList< PieAnimationDriver * > _aktive;
+	QPointer< QWindow >			  _win;
+	QBasicTimer					  _ersatz;
+	qint64						  _frame{ 0 };
+	bool						  _angefordert{ false };
+};
 #pragma endregion
 
 class QPieMenu : public QMenu
@@ -395,6 +516,35 @@ class QPieMenu : public QMenu
 	QAction *actionAt( const QPoint &pt ) const;
 	int		 actionIndexAt( const QPoint &pt ) const;
 	int		 actionIndex( QAction *a ) const { return actions().indexOf( a ); }
+	// Viele Actions auf einmal einfügen/ändern: dazwischen wird nicht neu berechnet, erst das
+	// äußerste endUpdate() berechnet Größen und Ruhepositionen genau einmal.  Auch ohne diese
+	// Klammer werden Action-Events zusammengefasst (LayoutRequest), die Klammer macht es nur
+	// sofort und explizit.
+	void	 beginUpdate() { ++_updateDepth; }
+	void	 endUpdate();
+	// Mausbewegungen werden je Frame zusammengefasst: moves kamen an, merged davon wurden von
+	// einer neueren überholt, evaluated Mal lief die Hover-Auswertung.
+	// predicted Mal kamen die Zoom-Ziele aus der Hover-Vorhersage.  zooms/zoomNs messen die Zeit
+	// vom Eintritt des Zeigers in die Nähe eines Elements bis zu dessen vollem Zoom.
+	struct InputStats
+	{
+		quint64 moves{ 0 }, merged{ 0 }, evaluated{ 0 }, predicted{ 0 }, zooms{ 0 };
+		qint64	zoomNs{ 0 };
+	};
+	const InputStats &inputStats() const { return _inputStats; }
+	// Strich-Modus (Marking-Menü): Wird die Maus mit gedrückter Taste bewegt, entscheiden nur
+	// Richtung und Abstand vom Mittelpunkt über die Auswahl - verglichen mit den Ruhewinkeln, also
+	// auch mitten in der Einblend-Animation oder bevor überhaupt etwas gemalt wurde.  Wer den Ring
+	// der Ruhepositionen überquert, steigt sofort ins Submenü ab; Loslassen wählt aus, weit
+	// jenseits des Rings bricht es ab.  Standardmäßig aus; Submenüs übernehmen ihn vom Elternmenü.
+	void			  setStrokeMode( bool on ) { _initData._strokeMode = on; }
+	bool			  strokeMode() const { return _initData._strokeMode; }
+	// Reaktionszeit vom Maus-/Tastatur-Event bis zum Ende des paintEvent, das die ausgelöste
+	// Zustandsänderung zeigt - prozessweit über alle Pies.  latencyJson() fasst beide Quellen
+	// für die Telemetrie zusammen.
+	enum class LatencySource { Mouse, Key };
+	static PieLatencyHistogram &latency( LatencySource s );
+	static QByteArray			latencyJson();
 
   signals:
 #pragma endregion
@@ -419,7 +569,7 @@ class QPieMenu : public QMenu
 	void mouseReleaseEvent( QMouseEvent *e ) override;
 	// -> ...
 	void keyPressEvent( QKeyEvent *e ) override;
-	// -> Animationen weiterschreiben, verzögertes Öffnen von Submenüs
+	// -> verzögertes Öffnen von Submenüs, Keyboard-Override
 	void timerEvent( QTimerEvent *e ) override;
 
 	// -> the wheel event could be used to rotate the items around.
@@ -437,6 +587,7 @@ class QPieMenu : public QMenu
 	// Redesign der privaten Menu-Anteile:
 	// -> Typen:
 	enum class PieMenuStatus { hidden = 0, still, closeby, hover, item_active };
+	using SmData = PieStateTable::Data;
 	// -> Variablen:
 	// Die Init-Daten (wie beschaffen?)
 	PieInitData		 _initData;
@@ -456,55 +607,169 @@ class QPieMenu : public QMenu
 	PieSelectionRect _selRect, _srS, _srE;
 
 	PieMenuStatus	 _state{ PieMenuStatus::hidden };
+	// Datenmodell der Zustandstabelle (aus diagrams/States.scxml erzeugt, siehe piestates.h)
+	SmData			 _sm;
 	// Sobald irgend etwas die aktuellen "_actionRects" invalidiert, wird dies gesetzt!
 	bool			 _actionRectsDirty{ true };
-	bool			 _selRectDirty{ false };
+	// Action-Events werden gesammelt, berechnet wird einmal danach (relayout())
+	bool			 _layoutPending{ false };
+	// Größen schon neu vermessen (layoutVorbereiten()), die Ruhepositionen stehen noch aus
+	bool			 _stillDirty{ false };
+	int				 _updateDepth{ 0 };
 	bool			 _mouseDown{ false };
 	// Mouse / Pointer Device:
 	QPoint			 _lastPos;
 	qreal			 _lastDm{ 0. }, _lastDi{ 1000. };
+	// Neueste, noch nicht ausgewertete Mausposition (Menü-Koordinaten) und ihr Zeitstempel (ms)
+	QPoint			 _zeigerPos;
+	quint64			 _zeigerTs{ 0 };
+	// Geschwindigkeit in px/ms und ihr Bezugspunkt
+	QPointF			 _zeigerV;
+	QPoint			 _vPos;
+	quint64			 _vTs{ 0 };
+	InputStats		 _inputStats;
+	// Latenz-Messung: Eingang des auslösenden Events (ns, 0 = keiner).  Wechselt die Eingabe den
+	// Zustand, wartet ihr Stempel in _anzeigeNs auf das nächste paintEvent.
+	qint64			 _eingangNs{ 0 }, _anzeigeNs{ 0 };
+	LatencySource	 _eingangVon{}, _anzeigeVon{};
+	// Strich-Modus: Bewegung mit gedrückter Taste gesehen, Zeitpunkt des Einblendens (ns)
+	bool			 _strich{ false };
+	qint64			 _gezeigtNs{ 0 };
+	// Laufende Zoom-Messung: Element und Eintrittszeit (ns), 0 = keine
+	int				 _messId{ -1 };
+	qint64			 _messStart{ 0 };
+	// Von der Hover-Vorhersage vorab berechnete Zoom-Ziele (zoomZiele()) für Element id
+	struct VorZoom
+	{
+		int				 id{ -1 };
+		QList< PieQuad > ziele;
+	} _vorZoom;
 	// verschiedene "current IDs":
 	//  _hoverId: ist im Endeffekt, was gerade gewählt ist - egal ob via KBD oder Mouse.
 	//  _folgeId: verfolgen wir im Moment -> muss vorgehalten werden falls die ID wechselt.
 	//  _alertId: bei Mouse-Hover mache ich Submenüs bei längerem Hovern auf, aber nur wenn die
 	//            _hoverId zwischendurch nicht gesprungen ist.
 	int				 _hoverId{ -1 }, _folgeId{ -1 }, _alertId{ -1 }, _lastWi{ -1 };
-	// Zeitanimationen
-	QBasicTimer		 _rectsAnimiert, _selRectAnimiert, _alertTimer, _kbdOvr;
-	QTime			 _selRectStart;
+	// Winkel-Index: Ruhewinkel aller Nicht-Separatoren, nach dem auf [0..2pi) normierten Winkel
+	// sortiert.  Wird nur in makeZielStill() neu aufgebaut - die Mausbewegung findet den Winkel-
+	// nächsten per Binärsuche und prüft nur die Boxen der Nachbarn.
+	struct WinkelEintrag
+	{
+		qreal w; // normiert, Sortierschlüssel
+		qreal a; // Ruhewinkel wie in SPElem
+		int	  id;
+	};
+	QList< WinkelEintrag > _winkelIndex;
+	static constexpr int   WINKEL_NACHBARN = 2;
+	// Tastatur: Nachbar im bzw. gegen den Uhrzeigersinn je Action (-1 bei Separatoren und
+	// unsichtbaren Actions) und das nächste Element zu jeder Ziffer des Nummernblocks (Index
+	// Taste - 1).  Entsteht zusammen mit dem Winkel-Index, die Tasten sind dann O(1).
+	QList< int >		   _nachbarCw, _nachbarCcw;
+	int					   _kompass[ 9 ]{ -1, -1, -1, -1, -1, -1, -1, -1, -1 };
+	// Zeitanimationen: Rects und Selection Rect laufen im Frame-Takt, der Rest über Timer
+	PieAnimationDriver _anim{ this, [ this ]( qint64 t ) { return animationFrame( t ); } };
+	QBasicTimer		 _alertTimer, _kbdOvr;
+	QList< QRect >	 _damage; // je Frame wiederverwendet
+	// Fertig gerenderte Boxen: Animationsframes sind damit nur noch Pixmap-Blits mit Opacity.
+	// Die Kosten sind KiB, begrenzt wird auf ITEM_CACHE_KB.
+	static constexpr int ITEM_CACHE_KB = 8 * 1024;
+	QCache< PieItemKey, QPixmap > _itemCache{ ITEM_CACHE_KB };
+	qint64			 _selRectStart{ 0 };
 	// showAsChild: quellmenu
 	QPieMenu		*_causedMenu{ nullptr };
+	// Im Hover vorbereitetes Layout (als Submenü): Schlüssel und laufende Berechnung
+	PieLayoutKey	 _vorKey{};
+	QFuture< PieLayout > _vorLayout;
 
 	// -> Methoden:
 	// Style-Daten beschaffen (bei init und bei StyleChange)
 	void			 readStyleData();
 	// Die Größen der Boxen berechnen -> Grunddaten
 	void			 calculatePieDataSizes();
-	// Kleiner Helfer, den ich ggf. an mehreren Stellen brauche
-	qreal			 startR( int runde ) const;
+	// Eine Action vermessen - aus dem prozessweiten Cache oder frisch
+	PieMetrics		 measure( QAction *action, bool menuHasCheckables );
+	static QCache< PieMetricsKey, PieMetrics > &metricsCache();
 	// Die Ruhepositionen berechnen
-	// Neuer Algorithmus: nutze StepBox, um die still-Daten zu berechnen
+	// Neuer Algorithmus: nutze StepBox (PieLayoutSolver), um die still-Daten zu berechnen
 	void			 createStillData();
+	void			 layoutUebernehmen( const PieLayout &l );
+	// Der Cache dazu: Schlüssel aus den aktuellen Größen und den Vorgaben init
+	PieLayoutKey	 layoutKey( const PieInitData &init ) const;
+	static QCache< PieLayoutKey, PieLayout > &layoutCache();
+	PieLayoutSolver	 solver() { return { _data, _initData, _styleData.sp, _avgSz }; }
+	// Als Submenü: die Vorgaben, die showAsChild() setzen wird
+	PieInitData		 kindInitData( qreal minRadius, qreal startAngle, qreal endAngle ) const;
+	// Beim Hover über dem Eltern-Element: vermessen und das Layout im Hintergrund lösen lassen
+	void			 layoutVorbereiten( qreal minRadius, qreal startAngle, qreal endAngle );
+	// Die Eltern-Seite davon: Submenü von Element index vorbereiten
+	void			 kindVorbereiten( int index );
+	// Größen und Ruhepositionen neu berechnen bzw. - falls angefordert - jetzt nachholen
+	void			 relayout();
+	void			 ensureLayout()
+	{
+		if ( _layoutPending ) relayout();
+		else if ( _stillDirty ) createStillData(), _actionRectsDirty = true;
+	}
 	// Spezialberechnungen:
 	void			 createZoom();
-	// Großer Helfer: berechne die nächste Box, gib das Delta zurück
-	qreal			 stepBox( int index, QRectF &rwsd, QSizeF &lastSz );
+	// Die Ziele von createZoom() für Element id, ohne _data anzufassen.  Einträge, die stepBox()
+	// nicht neu setzt, bleiben NaN - dort behält createZoom() das bisherige Ziel.
+	QList< PieQuad > zoomZiele( int id ) const;
 	// Grundsätzlich werden mit stepBox Zieldaten berechnet.
 	// Diese Funktion leitet aus den Zieldaten still-Daten ab.
 	void			 makeZielStill( qreal r0 );
 
 	void			 setState( PieMenuStatus s )
 	{
+		if ( _eingangNs ) _anzeigeNs = std::exchange( _eingangNs, 0 ), _anzeigeVon = _eingangVon;
 		qDebug() << "[[" << ( _state = s ) << "]]" << _folgeId << _hoverId;
 	}
-	void showChild( int index );
+	// r: Rect des Elements (Mittelpunkt-Koordinaten) - ohne Angabe das aktuelle _actionRect
+	void showChild( int index, QRect r = {} );
+	// Ziel des gezoomten Elements in Ruhe (Mittelpunkt-Koordinaten): dort landet das Selection
+	// Rect, dort geht sein Submenü auf
+	QRect zoomRect( int index ) const;
+	// Action index auslösen (kein Submenü) und das Menü samt Eltern schließen
+	void ausloesen( int index );
+	// Strich-Modus: p in Mittelpunkt-Koordinaten.  Beim Loslassen wird ausgewählt, während der
+	// Bewegung nur in Submenüs abgestiegen.  Loslassen weiter als Radius + Boxgröße vom Mittelpunkt
+	// schließt das Menü.  true, wenn etwas passiert ist.
+	bool strichAuswerten( QPoint p, bool loslassen );
 	void initVisible( bool show );
 	void initStill();
 	void initCloseBy( int newFID = -1 );
 	void initHover( int newHID = -1 );
 	void initActive();
 	void updateCurrentVisuals();
-	bool hitTest( const QPoint &p, qreal &mindDistance, qint32 &minDistID );
+	// Hover-Auswertung der gesammelten Mausposition - true, wenn sich der Zustand geändert hat.
+	bool zeigerAuswerten();
+	// Ein Event durch die Zustandstabelle schicken - die Übergänge rufen initStill(), initHover()
+	// und initCloseBy().  Gibt die Anzahl der Zustandswechsel zurück.
+	int	 zustandsEvent( PieStateTable::Event ev, const SmData &e );
+	// Hit-Test samt Close-By-Regeln für einen Punkt: gibt die Ziel-ID zurück, di ist der
+	// Box-Abstand und wi das Winkel-nächste Element.
+	int	 zielBei( QPoint p, qreal &di, bool &hit, bool &closeBy, int &wi );
+	// Radius des nicht-reaktiven Kreises um den Mittelpunkt
+	qreal totzone() const;
+	int	 vorhersageMs() const;
+	// Zoom-Messung für InputStats: id = Element, in dessen Nähe der Zeiger gerade ist (oder -1)
+	void zoomMessung( int id );
+	// Steht noch eine Mausposition aus, wird sie sofort ausgewertet (vor Klicks)
+	void zeigerNachholen();
+	// Die Box von Action i in der (auf 1/16 gerasterten) Skalierung - aus dem Cache oder frisch
+	// gerendert.
+	QPixmap itemPixmap( int i, bool selected, qreal scale, qreal dpr );
+	// nullptr: alles verwerfen
+	void	invalidateItemCache( const QAction *a = nullptr );
+	// Ein Schritt aller laufenden Animationen, aufgerufen vom PieAnimationScheduler.  Gibt die
+	// Region (Widget-Koordinaten) zurück, die neu gezeichnet werden muss.
+	QRegion animationFrame( qint64 now );
+	// "around": Position im Winkel-Index, um die herum gesucht wird - bei -1 (oder während die
+	// Boxen animiert werden) werden alle Boxen gebündelt per PieSimd geprüft.
+	bool hitTest( const QPoint &p, qreal &mindDistance, qint32 &minDistID, int around = -1 );
+	void buildWinkelIndex();
+	// Position des Winkel-nächsten Eintrags im Winkel-Index, -1 wenn er leer ist
+	int	 winkelNaechster( qreal w ) const;
 	// Ein kluger Hit-Test rechnet einfach - wir nutzen diese Signed Distance Function:
 	auto boxDistance( const auto &p, const auto &b ) const
 	{
@@ -519,7 +784,9 @@ class QPieMenu : public QMenu
 	void childHidden( QPieMenu *child, bool hasTriggered );
 	// -> Variablen - Windows-spezifisch:
 	//      das transparente Fenster sollte keinen Schatten werfen !0 => geschafft!
+#if _WIN32
 	HWND _dropShadowRemoved{ nullptr };
+#endif
 	// -> Method hiding:
 	// Tearing our menus off is not allowed -> make setting it private
 	using QMenu::setTearOffEnabled;
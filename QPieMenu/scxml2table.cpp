@@ -0,0 +1,564 @@
+/******************************************************************************
+ * scxml2table.cpp - erzeugt aus diagrams/States.scxml eine constexpr-Tabelle
+ * ============================================================
+ * Author: Stefan <St0fF / the0bsessedManiacs> Kaps
+ ******************************************************************************
+ *  Diese Datei ist Teil von PieMenuTesting.
+ *
+ *  PieMenuTesting ist Freie Software: Sie können es unter den Bedingungen
+ *  der GNU General Public License, wie von der Free Software Foundation,
+ *  Version 3 der Lizenz oder (nach Ihrer Wahl) jeder neueren
+ *  veröffentlichten Version, weiter verteilen und/oder modifizieren.
+ *
+ *  PieMenuTesting wird in der Hoffnung, dass es nützlich sein wird, aber
+ *  OHNE JEDE GEWÄHRLEISTUNG, bereitgestellt; sogar ohne die implizite
+ *  Gewährleistung der MARKTFÄHIGKEIT oder EIGNUNG FÜR EINEN BESTIMMTEN ZWECK.
+ *  Siehe die GNU General Public License für weitere Details.
+ *
+ *  Sie sollten eine Kopie der GNU General Public License zusammen mit diesem
+ *  Programm erhalten haben. Wenn nicht, siehe <https://www.gnu.org/licenses/>.
+ ******************************************************************************
+ * Aufruf: scxml2table <Eingabe.scxml> <Ausgabe.h>
+ *
+ * Der Statechart im Qt-Designer bleibt die Quelle der Wahrheit, QScxml samt QVariant-Datenmodell
+ * braucht es zur Laufzeit aber nicht.  Dieses Werkzeug läuft beim Build und schreibt einen Header
+ * mit Zuständen, Events, Datenmodell als struct, den Übergängen als constexpr-Tabelle und den
+ * Bedingungen/Aktionen als C++-Funktionen.  Ausgeführt wird das Ganze von piestates.h.
+ *
+ * Unterstützt wird genau das, was das Diagramm benutzt:
+ *  -   <state>, <parallel>, <final>, <transition> mit event/cond/target/type
+ *  -   <onentry>, <onexit>, <assign>, <raise>, <send> (event + delay, id nur gleich dem Event), <cancel>
+ *  -   <data> mit bool- oder Zahlen-Ausdruck, der Typ ergibt sich aus dem Startwert
+ *  -   Ausdrücke aus Zahlen, Datenmodell-Namen, _event.data.X, Vergleichen, + - * /,
+ *      not/and/or bzw. ! && ||
+ * Alles andere bricht mit einer Fehlermeldung ab - lieber kein Build als eine stille Abweichung.
+ * Bewusst nur Standard-C++, damit das Werkzeug ohne Qt gebaut werden kann.
+ *****************************************************************************/
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+	[[noreturn]] void fehler( const std::string &msg )
+	{
+		std::cerr << "scxml2table: " << msg << std::endl;
+		std::exit( 1 );
+	}
+	bool ziffer( char c )
+	{
+		return std::isdigit( (unsigned char)c );
+	}
+	bool namenszeichen( char c, const char *extra )
+	{
+		return std::isalnum( (unsigned char)c ) || ( c && std::strchr( extra, c ) );
+	}
+
+#pragma region( XML )
+	struct Knoten
+	{
+		std::string									 name;
+		std::map< std::string, std::string >		 attr;
+		std::vector< std::unique_ptr< Knoten > >	 kinder;
+
+		std::string									 a( const std::string &n ) const
+		{
+			auto it = attr.find( n );
+			return it == attr.end() ? std::string() : it->second;
+		}
+		bool										 hat( const std::string &n ) const
+		{
+			return attr.count( n );
+		}
+	};
+
+	// Gerade genug XML für Dateien aus dem Qt-Designer: Elemente, Attribute, Kommentare,
+	// Prolog.  Text zwischen den Elementen wird übersprungen.
+	class Parser
+	{
+	  public:
+		explicit Parser( std::string s ) : _s( std::move( s ) ) {}
+
+		std::unique_ptr< Knoten > dokument()
+		{
+			for ( ;; )
+			{
+				ueberspringeText();
+				if ( _p >= _s.size() ) fehler( "kein Wurzelelement" );
+				if ( !ueberspringeSonstiges() ) return element();
+			}
+		}
+
+	  private:
+		std::string _s;
+		size_t		_p{ 0 };
+
+		void		ueberspringeText()
+		{
+			while ( _p < _s.size() && _s[ _p ] != '<' ) ++_p;
+		}
+		void ueberspringeLeer()
+		{
+			while ( _p < _s.size() && std::isspace( (unsigned char)_s[ _p ] ) ) ++_p;
+		}
+		// <?...?>, <!--...--> und <!...> - true, wenn etwas übersprungen wurde
+		bool ueberspringeSonstiges()
+		{
+			auto bis = [ this ]( const char *ende )
+			{
+				auto e = _s.find( ende, _p );
+				if ( e == std::string::npos ) fehler( std::string( "fehlendes " ) + ende );
+				_p = e + std::char_traits< char >::length( ende );
+				return true;
+			};
+			if ( !_s.compare( _p, 2, "<?" ) ) return bis( "?>" );
+			if ( !_s.compare( _p, 4, "<!--" ) ) return bis( "-->" );
+			if ( !_s.compare( _p, 2, "<!" ) ) return bis( ">" );
+			return false;
+		}
+		std::string name()
+		{
+			auto st = _p;
+			while ( _p < _s.size() && namenszeichen( _s[ _p ], ":_-." ) ) ++_p;
+			if ( st == _p ) fehler( "Name erwartet bei Offset " + std::to_string( _p ) );
+			return _s.substr( st, _p - st );
+		}
+		static std::string entities( const std::string &v )
+		{
+			static const std::pair< const char *, char > tab[] = {
+				{ "&lt;", '<' },	 { "&gt;", '>' },	 { "&amp;", '&' },
+				{ "&quot;", '"' }, { "&apos;", '\'' },
+			};
+			std::string r;
+			for ( size_t i = 0; i < v.size(); )
+			{
+				bool ok = false;
+				if ( v[ i ] == '&' )
+					for ( auto &[ e, c ] : tab )
+						if ( !v.compare( i, std::char_traits< char >::length( e ), e ) )
+						{
+							r += c, i += std::char_traits< char >::length( e ), ok = true;
+							break;
+						}
+				if ( !ok ) r += v[ i++ ];
+			}
+			return r;
+		}
+		std::unique_ptr< Knoten > element()
+		{
+			auto k = std::make_unique< Knoten >();
+			++_p; // '<'
+			k->name = name();
+			for ( ;; )
+			{
+				ueberspringeLeer();
+				if ( _p >= _s.size() ) fehler( "unerwartetes Dateiende in <" + k->name + ">" );
+				if ( !_s.compare( _p, 2, "/>" ) ) return _p += 2, std::move( k );
+				if ( _s[ _p ] == '>' ) break;
+				auto n = name();
+				ueberspringeLeer();
+				if ( _s[ _p++ ] != '=' ) fehler( "'=' erwartet nach " + n );
+				ueberspringeLeer();
+				char q = _s[ _p++ ];
+				auto e = _s.find( q, _p );
+				if ( ( q != '"' && q != '\'' ) || e == std::string::npos )
+					fehler( "Attributwert von " + n + " kaputt" );
+				k->attr[ n ] = entities( _s.substr( _p, e - _p ) );
+				_p			 = e + 1;
+			}
+			++_p; // '>'
+			for ( ;; )
+			{
+				ueberspringeText();
+				if ( _p >= _s.size() ) fehler( "</" + k->name + "> fehlt" );
+				if ( ueberspringeSonstiges() ) continue;
+				if ( !_s.compare( _p, 2, "</" ) )
+				{
+					_p += 2;
+					if ( name() != k->name ) fehler( "falsches Ende-Tag für <" + k->name + ">" );
+					ueberspringeLeer();
+					++_p; // '>'
+					return k;
+				}
+				k->kinder.push_back( element() );
+			}
+		}
+	};
+#pragma endregion
+
+#pragma region( Modell )
+	struct Zustand
+	{
+		std::string id;
+		int			eltern{ -1 }, start{ -1 }, eintritt{ -1 }, austritt{ -1 };
+		bool		parallel{ false };
+	};
+	struct Uebergang
+	{
+		int	 quelle, ereignis, ziel{ -1 }, bedingung{ -1 }, aktion{ -1 };
+		bool intern;
+	};
+	struct Datum
+	{
+		std::string id, expr;
+		bool		istBool;
+	};
+
+	struct Modell
+	{
+		std::vector< Zustand >				 zustaende;
+		std::vector< std::string >			 ereignisse;
+		std::vector< Datum >				 daten;
+		std::vector< Uebergang >			 uebergaenge;
+		std::vector< std::string >			 bedingungen; // bereits nach C++ übersetzt
+		std::vector< std::vector< std::string > > aktionen;	  // je Aktion die C++-Zeilen
+		std::string							 initial;
+
+		int									 zustand( const std::string &id ) const
+		{
+			for ( size_t i = 0; i < zustaende.size(); ++i )
+				if ( zustaende[ i ].id == id ) return int( i );
+			fehler( "unbekannter Zustand '" + id + "'" );
+		}
+		int ereignis( const std::string &n )
+		{
+			for ( size_t i = 0; i < ereignisse.size(); ++i )
+				if ( ereignisse[ i ] == n ) return int( i );
+			ereignisse.push_back( n );
+			return int( ereignisse.size() - 1 );
+		}
+		// Name für den erzeugten Code - das Event wird dabei registriert
+		std::string event( const std::string &n )
+		{
+			return ereignisse[ ereignis( n ) ];
+		}
+		const Datum *datum( const std::string &n ) const
+		{
+			for ( auto &d : daten )
+				if ( d.id == n ) return &d;
+			return nullptr;
+		}
+
+		// ECMAScript-Ausdruck -> C++.  Datenmodell-Namen bekommen das Präfix (d. oder nichts),
+		// _event.data.X wird zu e.X.
+		std::string ausdruck( const std::string &x, const std::string &praefix ) const
+		{
+			std::string r;
+			for ( size_t i = 0; i < x.size(); )
+			{
+				char c = x[ i ];
+				if ( std::isspace( (unsigned char)c ) )
+				{
+					++i;
+					continue;
+				}
+				if ( ziffer( c ) || ( c == '.' && i + 1 < x.size() && ziffer( x[ i + 1 ] ) ) )
+				{
+					auto st = i;
+					while ( i < x.size() && ( ziffer( x[ i ] ) || x[ i ] == '.' ) ) ++i;
+					r += x.substr( st, i - st );
+					continue;
+				}
+				if ( std::isalpha( (unsigned char)c ) || c == '_' )
+				{
+					auto st = i;
+					while ( i < x.size() && namenszeichen( x[ i ], "_." ) ) ++i;
+					auto w = x.substr( st, i - st );
+					if ( w == "not" ) r += "!";
+					else if ( w == "and" ) r += " && ";
+					else if ( w == "or" ) r += " || ";
+					else if ( w == "true" || w == "false" ) r += w;
+					else if ( !w.compare( 0, 12, "_event.data." ) && datum( w.substr( 12 ) ) )
+						r += "e." + w.substr( 12 );
+					else if ( datum( w ) ) r += praefix + w;
+					else fehler( "unbekannter Name '" + w + "' in \"" + x + "\"" );
+					continue;
+				}
+				static const char *ops[] = { "===", "!==", "==", "!=", "<=", ">=", "&&", "||",
+											 "<",   ">",   "!",  "(",  ")",  "+",  "-",
+											 "*",	"/" };
+				bool ok = false;
+				for ( auto op : ops )
+					if ( !x.compare( i, std::char_traits< char >::length( op ), op ) )
+					{
+						std::string o = op;
+						if ( o == "===" ) o = "==";
+						if ( o == "!==" ) o = "!=";
+						// Vorzeichen: am Anfang, nach "(" oder nach einem anderen Operator
+						auto unaer = o == "-" && ( r.empty() || std::strchr( " (!", r.back() ) );
+						if ( o == "(" || o == ")" || o == "!" || unaer ) r += o;
+						else r += " " + o + " ";
+						i += std::char_traits< char >::length( op ), ok = true;
+						break;
+					}
+				if ( !ok )
+					fehler( std::string( "unerwartetes Zeichen '" ) + c + "' in \"" + x + "\"" );
+			}
+			return r;
+		}
+
+		// "1s", "250ms", "1.5s" -> Millisekunden
+		static long verzoegerung( const std::string &d )
+		{
+			char *e;
+			auto  v = std::strtod( d.c_str(), &e );
+			std::string einheit( e );
+			if ( einheit == "ms" ) return long( v );
+			if ( einheit == "s" ) return long( v * 1000 );
+			fehler( "Verzögerung '" + d + "' nicht verstanden" );
+		}
+
+		// Ausführbarer Inhalt -> Index in aktionen, -1 wenn leer
+		int aktion( const Knoten &k )
+		{
+			std::vector< std::string > zeilen;
+			for ( auto &c : k.kinder )
+			{
+				if ( c->name == "assign" )
+				{
+					auto loc = c->a( "location" );
+					if ( !datum( loc ) ) fehler( "assign auf unbekanntes '" + loc + "'" );
+					zeilen.push_back( "d." + loc + " = " + ausdruck( c->a( "expr" ), "d." ) + ";" );
+				} else if ( c->name == "raise" )
+					zeilen.push_back( "m.raise( " + event( c->a( "event" ) ) + " );" );
+				else if ( c->name == "send" )
+				{
+					if ( c->hat( "target" ) ) fehler( "<send> mit target wird nicht unterstützt" );
+					auto ms = c->hat( "delay" ) ? verzoegerung( c->a( "delay" ) ) : 0;
+					zeilen.push_back( "m.senden( " + event( c->a( "event" ) ) + ", "
+									  + std::to_string( ms ) + " );" );
+				} else if ( c->name == "cancel" )
+					// Ohne eigene send-id heißt ein <send> wie sein Event
+					zeilen.push_back( "m.abbrechen( " + event( c->a( "sendid" ) ) + " );" );
+				else if ( c->name.find( ':' ) == std::string::npos )
+					fehler( "<" + c->name + "> wird nicht unterstützt" );
+			}
+			if ( zeilen.empty() ) return -1;
+			aktionen.push_back( zeilen );
+			return int( aktionen.size() - 1 );
+		}
+		int bedingung( const std::string &cond )
+		{
+			auto c = ausdruck( cond, "d." );
+			for ( size_t i = 0; i < bedingungen.size(); ++i )
+				if ( bedingungen[ i ] == c ) return int( i );
+			bedingungen.push_back( c );
+			return int( bedingungen.size() - 1 );
+		}
+
+		static bool istZustand( const Knoten &k )
+		{
+			return k.name == "state" || k.name == "parallel" || k.name == "final";
+		}
+		// 1. Durchgang: alle Zustände in Dokumentreihenfolge
+		void sammle( const Knoten &k, int eltern )
+		{
+			for ( auto &c : k.kinder )
+				if ( istZustand( *c ) )
+				{
+					if ( !c->hat( "id" ) ) fehler( "Zustand ohne id" );
+					zustaende.push_back( { c->a( "id" ), eltern } );
+					zustaende.back().parallel = c->name == "parallel";
+					sammle( *c, int( zustaende.size() - 1 ) );
+				}
+		}
+		// 2. Durchgang: Start-Kinder, Ein-/Austritt, Übergänge (Events in Dokumentreihenfolge)
+		void auswerten( const Knoten &k, int s )
+		{
+			auto &z = zustaende[ s ];
+			if ( k.hat( "initial" ) ) z.start = zustand( k.a( "initial" ) );
+			for ( auto &c : k.kinder )
+			{
+				if ( istZustand( *c ) )
+				{
+					if ( !z.parallel && z.start < 0 ) z.start = zustand( c->a( "id" ) );
+					auswerten( *c, zustand( c->a( "id" ) ) );
+				} else if ( c->name == "onentry" || c->name == "onexit" )
+				{
+					auto &ziel = c->name == "onentry" ? z.eintritt : z.austritt;
+					if ( ziel >= 0 ) fehler( "mehrfaches <" + c->name + "> in " + z.id );
+					ziel = aktion( *c );
+				} else if ( c->name == "transition" )
+				{
+					std::istringstream evs( c->a( "event" ) );
+					std::string		   ev;
+					Uebergang		   u{ s, -1, -1, -1, -1, false };
+					if ( c->hat( "target" ) )
+					{
+						auto t = c->a( "target" );
+						if ( t.find( ' ' ) != std::string::npos ) fehler( "mehrere Ziele: " + t );
+						u.ziel = zustand( t );
+					}
+					if ( c->hat( "cond" ) ) u.bedingung = bedingung( c->a( "cond" ) );
+					u.intern = c->a( "type" ) == "internal";
+					std::vector< int > ids;
+					while ( evs >> ev ) ids.push_back( ereignis( ev ) );
+					if ( ids.empty() )
+						fehler( "eventlose Übergänge werden nicht unterstützt (" + z.id + ")" );
+					u.aktion = aktion( *c );
+					for ( auto id : ids ) u.ereignis = id, uebergaenge.push_back( u );
+				}
+			}
+		}
+	};
+
+	Modell lesen( const Knoten &scxml )
+	{
+		if ( scxml.name != "scxml" ) fehler( "<scxml> erwartet" );
+		Modell m;
+		for ( auto &c : scxml.kinder )
+			if ( c->name == "datamodel" )
+				for ( auto &d : c->kinder )
+					if ( d->name == "data" )
+					{
+						auto x = d->a( "expr" );
+						m.daten.push_back( { d->a( "id" ), x, x == "true" || x == "false" } );
+					}
+		// Startwerte dürfen nur auf vorher deklarierte Daten zugreifen (Member-Initialisierung)
+		for ( size_t i = 0; i < m.daten.size(); ++i )
+		{
+			Modell vorher;
+			vorher.daten.assign( m.daten.begin(), m.daten.begin() + i );
+			m.daten[ i ].expr = vorher.ausdruck( m.daten[ i ].expr, "" );
+		}
+		m.sammle( scxml, -1 );
+		if ( m.zustaende.empty() ) fehler( "keine Zustände" );
+		if ( m.zustaende.size() > 32 ) fehler( "mehr als 32 Zustände" );
+		m.initial = scxml.hat( "initial" ) ? scxml.a( "initial" ) : m.zustaende[ 0 ].id;
+		for ( auto &c : scxml.kinder )
+			if ( Modell::istZustand( *c ) ) m.auswerten( *c, m.zustand( c->a( "id" ) ) );
+		return m;
+	}
+#pragma endregion
+
+#pragma region( Ausgabe )
+	std::string liste( const std::vector< std::string > &v )
+	{
+		std::string r;
+		for ( size_t i = 0; i < v.size(); ++i ) r += ( i ? ", " : "" ) + v[ i ];
+		return r;
+	}
+	template < class F >
+	std::string jeZustand( const Modell &m, F f )
+	{
+		std::vector< std::string > v;
+		for ( auto &z : m.zustaende ) v.push_back( f( z ) );
+		return liste( v );
+	}
+
+	std::string schreiben( const Modell &m, const std::string &quelle )
+	{
+		std::ostringstream o;
+		const auto		   nz = m.zustaende.size(), ne = m.ereignisse.size();
+		o << "// Erzeugt von scxml2table aus " << quelle << " - nicht von Hand ändern!\n"
+		  << "#pragma once\n\n#include <QtGlobal>\n\nnamespace PieStateTable\n{\n";
+		// Zustände und Events
+		o << "\tenum State : qint8 { "
+		  << jeZustand( m, []( auto &z ) { return z.id; } ) << ", StateCount };\n";
+		o << "\tenum Event : qint8 { " << liste( m.ereignisse ) << ", EventCount };\n";
+		o << "\tconstexpr State initial = " << m.initial << ";\n";
+		o << "\tconstexpr const char *stateNames[ StateCount ] = { "
+		  << jeZustand( m, []( auto &z ) { return "\"" + z.id + "\""; } ) << " };\n";
+		{
+			std::vector< std::string > n;
+			for ( auto &e : m.ereignisse ) n.push_back( "\"" + e + "\"" );
+			o << "\tconstexpr const char *eventNames[ EventCount ] = { " << liste( n ) << " };\n";
+		}
+		// Hierarchie
+		o << "\t// Elternzustand, -1: Dokument\n\tconstexpr qint8 eltern[ StateCount ] = { "
+		  << jeZustand( m, []( auto &z ) { return std::to_string( z.eltern ); } ) << " };\n";
+		o << "\t// Start-Kind eines zusammengesetzten Zustands, -1: atomar oder parallel\n"
+		  << "\tconstexpr qint8 start[ StateCount ] = { "
+		  << jeZustand( m, []( auto &z ) { return std::to_string( z.start ); } ) << " };\n";
+		o << "\tconstexpr bool parallel[ StateCount ] = { "
+		  << jeZustand( m, []( auto &z ) { return z.parallel ? "true" : "false"; } ) << " };\n";
+		o << "\t// Aktion bei <onentry>/<onexit>, -1: keine\n"
+		  << "\tconstexpr qint8 eintritt[ StateCount ] = { "
+		  << jeZustand( m, []( auto &z ) { return std::to_string( z.eintritt ); } ) << " };\n";
+		o << "\tconstexpr qint8 austritt[ StateCount ] = { "
+		  << jeZustand( m, []( auto &z ) { return std::to_string( z.austritt ); } ) << " };\n\n";
+		// Datenmodell
+		o << "\t// Datenmodell - dient auch als _event.data\n\tstruct Data\n\t{\n";
+		for ( auto &d : m.daten )
+			o << "\t\t" << ( d.istBool ? "bool" : "qreal" ) << " " << d.id << "{ " << d.expr
+			  << " };\n";
+		o << "\t};\n\n";
+		// Übergänge, nach Quelle gruppiert - innerhalb der Gruppe zählt die Dokumentreihenfolge
+		o << "\tstruct Transition\n\t{\n\t\tState quelle;\n\t\tEvent ereignis;\n"
+		  << "\t\tqint8 ziel, bedingung, aktion; // -1: kein Ziel / immer / keine\n"
+		  << "\t\tbool  intern;\n\t};\n";
+		using Zeile = std::vector< std::pair< int, int > >;
+		std::vector< Zeile >	   bereich( nz, Zeile( ne, { 0, 0 } ) );
+		std::vector< std::string > zeilen;
+		for ( size_t s = 0; s < nz; ++s )
+			for ( size_t e = 0; e < ne; ++e )
+			{
+				bereich[ s ][ e ].first = int( zeilen.size() );
+				for ( auto &u : m.uebergaenge )
+					if ( u.quelle == int( s ) && u.ereignis == int( e ) )
+						zeilen.push_back( "{ " + m.zustaende[ s ].id + ", " + m.ereignisse[ e ]
+										  + ", " + std::to_string( u.ziel ) + ", "
+										  + std::to_string( u.bedingung ) + ", "
+										  + std::to_string( u.aktion ) + ", "
+										  + ( u.intern ? "true" : "false" ) + " }" );
+				bereich[ s ][ e ].second = int( zeilen.size() ) - bereich[ s ][ e ].first;
+			}
+		o << "\tconstexpr Transition transitions[] = {\n";
+		for ( auto &z : zeilen ) o << "\t\t" << z << ",\n";
+		o << "\t};\n";
+		o << "\t// [Zustand][Event] -> { erster Übergang, Anzahl }\n"
+		  << "\tstruct Bereich\n\t{\n\t\tquint8 erster, anzahl;\n\t};\n"
+		  << "\tconstexpr Bereich suche[ StateCount ][ EventCount ] = {\n";
+		for ( size_t s = 0; s < nz; ++s )
+		{
+			std::vector< std::string > v;
+			for ( size_t e = 0; e < ne; ++e )
+				v.push_back( "{ " + std::to_string( bereich[ s ][ e ].first ) + ", "
+							 + std::to_string( bereich[ s ][ e ].second ) + " }" );
+			o << "\t\t{ " << liste( v ) << " }, // " << m.zustaende[ s ].id << "\n";
+		}
+		o << "\t};\n\n";
+		// Bedingungen und Aktionen
+		o << "\tconstexpr bool bedingung( int b, const Data &d, [[maybe_unused]] const Data &e )\n"
+		  << "\t{\n"
+		  << "\t\tswitch ( b )\n\t\t{\n";
+		for ( size_t i = 0; i < m.bedingungen.size(); ++i )
+			o << "\t\t\tcase " << i << ": return " << m.bedingungen[ i ] << ";\n";
+		o << "\t\t}\n\t\treturn true;\n\t}\n\n";
+		o << "\ttemplate < class M >\n"
+		  << "\tvoid aktion( int a, Data &d, [[maybe_unused]] const Data &e,\n"
+		  << "\t\t\t\t [[maybe_unused]] M &m )\n"
+		  << "\t{\n\t\tswitch ( a )\n\t\t{\n";
+		for ( size_t i = 0; i < m.aktionen.size(); ++i )
+		{
+			o << "\t\t\tcase " << i << ":\n";
+			for ( auto &z : m.aktionen[ i ] ) o << "\t\t\t\t" << z << "\n";
+			o << "\t\t\t\tbreak;\n";
+		}
+		o << "\t\t}\n\t}\n} // namespace PieStateTable\n";
+		return o.str();
+	}
+#pragma endregion
+} // namespace
+
+int main( int argc, char **argv )
+{
+	if ( argc != 3 ) fehler( "Aufruf: scxml2table <Eingabe.scxml> <Ausgabe.h>" );
+	std::ifstream ein( argv[ 1 ], std::ios::binary );
+	if ( !ein ) fehler( std::string( "kann " ) + argv[ 1 ] + " nicht lesen" );
+	std::stringstream ss;
+	ss << ein.rdbuf();
+	auto quelle = std::string( argv[ 1 ] );
+	auto text	= schreiben( lesen( *Parser( ss.str() ).dokument() ),
+							 quelle.substr( quelle.find_last_of( "/\\" ) + 1 ) );
+	std::ofstream aus( argv[ 2 ], std::ios::binary );
+	if ( !( aus << text ) ) fehler( std::string( "kann " ) + argv[ 2 ] + " nicht schreiben" );
+	return 0;
+}